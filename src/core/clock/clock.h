@@ -0,0 +1,180 @@
+/**
+ * @file src/core/clock/clock.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#ifndef __HND_CLOCK_H__
+#define __HND_CLOCK_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../../core/debug.h"
+#include <stdint.h>
+
+#define HND_NANOSECONDS_PER_SECOND      1000000000ull
+#define HND_NANOSECONDS_PER_MILLISECOND 1000000ull
+#define HND_NANOSECONDS_PER_MICROSECOND 1000ull
+
+/* @note How close to a deadline hnd_sleep_until_ns stops sleeping and starts spinning,
+ * about what the scheduler may oversleep by.
+ */
+#define HND_SLEEP_SPIN_THRESHOLD (300 * HND_NANOSECONDS_PER_MICROSECOND)
+
+/**
+ * @brief Gets the monotonic clock.
+ *
+ * @note Only differences between readings are meaningful. Never goes backwards.
+ *
+ * @return Nanoseconds since an unspecified point.
+ */
+uint64_t
+hnd_get_clock_ns
+(
+  void
+);
+
+/**
+ * @brief Sleeps until the monotonic clock reaches a deadline.
+ *
+ * @note Sleeps in the kernel up to HND_SLEEP_SPIN_THRESHOLD before the deadline and
+ * spins the rest, so it wakes up on time without burning a core the whole wait.
+ *
+ * @param _deadline Specifies the hnd_get_clock_ns value to wake up at.
+ */
+void
+hnd_sleep_until_ns
+(
+  uint64_t _deadline
+);
+
+/* @note How long hnd_calibrate_clock_ticks measures the time stamp counter by default */
+#define HND_CLOCK_CALIBRATION_TIME (20 * HND_NANOSECONDS_PER_MILLISECOND)
+
+/**
+ * @brief Measures the time stamp counter against the monotonic clock, so
+ * hnd_get_clock_ticks can read it instead of asking the OS.
+ *
+ * @note Sleeps for _duration_ns, call it once at startup. Only x86 CPUs with an invariant
+ * TSC qualify, ticks stay nanoseconds anywhere else.
+ *
+ * @param _duration_ns Specifies how long to measure, up to a second, or 0 for
+ *                     HND_CLOCK_CALIBRATION_TIME.
+ *
+ * @return HND_OK if ticks now come from the time stamp counter.
+ */
+int
+hnd_calibrate_clock_ticks
+(
+  uint64_t _duration_ns
+);
+
+/**
+ * @brief Gets the cheapest clock available, for timing short spans.
+ *
+ * @note Ticks are only good for differences, turn those into nanoseconds with
+ * hnd_ticks_to_ns. Before hnd_calibrate_clock_ticks, ticks are nanoseconds.
+ */
+uint64_t
+hnd_get_clock_ticks
+(
+  void
+);
+
+uint64_t
+hnd_ticks_to_ns
+(
+  uint64_t _ticks
+);
+
+/**
+ * @brief Frame time statistics, see hnd_wait_frame_limiter.
+ *
+ * @note work_ns is the time from the end of a wait to the start of the next one, i.e.
+ * what the frame took before being held back.
+ */
+typedef struct hnd_frame_stats_t
+{
+  uint64_t frame_count;
+  uint64_t missed_deadlines;
+
+  uint64_t frame_ns;
+  uint64_t work_ns;
+  uint64_t min_frame_ns;
+  uint64_t max_frame_ns;
+  /* @note Exponential moving average, weights the last frame by 1/16 */
+  uint64_t average_frame_ns;
+} hnd_frame_stats_t;
+
+/**
+ * @brief Holds a loop to a target frame time.
+ */
+typedef struct hnd_frame_limiter_t
+{
+  /* @note 0 doesn't limit, stats are still kept */
+  uint64_t target_ns;
+  uint64_t deadline;
+  uint64_t frame_start;
+
+  hnd_frame_stats_t stats;
+} hnd_frame_limiter_t;
+
+/**
+ * @param _limiter   Specifies the limiter.
+ * @param _target_ns Specifies the frame time, e.g. HND_NANOSECONDS_PER_SECOND / 60, or 0.
+ */
+void
+hnd_init_frame_limiter
+(
+  hnd_frame_limiter_t *_limiter,
+  uint64_t             _target_ns
+);
+
+/**
+ * @brief Changes the target frame time, from the next frame on.
+ */
+void
+hnd_set_frame_limit
+(
+  hnd_frame_limiter_t *_limiter,
+  uint64_t             _target_ns
+);
+
+/**
+ * @brief Ends a frame: sleeps until its deadline and updates the stats.
+ *
+ * @note A frame that misses its deadline isn't made up for, the next one is scheduled a
+ * full target after it instead of rushing to catch up.
+ */
+void
+hnd_wait_frame_limiter
+(
+  hnd_frame_limiter_t *_limiter
+);
+
+void
+hnd_reset_frame_stats
+(
+  hnd_frame_limiter_t *_limiter
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_CLOCK_H__ */
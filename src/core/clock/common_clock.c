@@ -0,0 +1,173 @@
+/**
+ * @file src/core/clock/common_clock.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "clock.h"
+#include "../cpu.h"
+#include "../profile/profile.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HND_READ_TSC() __builtin_ia32_rdtsc()
+#else
+#define HND_READ_TSC() 0
+#endif /* __x86_64__ || __i386__ */
+
+/* @note Nanoseconds per tick, 32.32 fixed point */
+static int tick_clock_tsc = HND_NK;
+static uint64_t tick_scale;
+
+int
+hnd_calibrate_clock_ticks
+(
+  uint64_t _duration_ns
+)
+{
+  if (!_duration_ns)
+    _duration_ns = HND_CLOCK_CALIBRATION_TIME;
+  if (!hnd_assert(_duration_ns <= HND_NANOSECONDS_PER_SECOND, HND_SYNTAX))
+    return HND_NK;
+
+  if (!(hnd_get_cpu_features() & HND_CPU_INVARIANT_TSC))
+  {
+    hnd_print_debug(HND_LOG, "No invariant time stamp counter", "Ticks are nanoseconds");
+
+    return HND_NK;
+  }
+
+  uint64_t start_ns = hnd_get_clock_ns();
+  uint64_t start_tsc = HND_READ_TSC();
+  hnd_sleep_until_ns(start_ns + _duration_ns);
+  uint64_t end_tsc = HND_READ_TSC();
+  uint64_t end_ns = hnd_get_clock_ns();
+
+  if (end_tsc <= start_tsc)
+    return HND_NK;
+
+  tick_scale = ((end_ns - start_ns) << 32) / (end_tsc - start_tsc);
+  tick_clock_tsc = HND_OK;
+
+  return HND_OK;
+}
+
+uint64_t
+hnd_get_clock_ticks
+(
+  void
+)
+{
+  if (tick_clock_tsc)
+    return HND_READ_TSC();
+
+  return hnd_get_clock_ns();
+}
+
+uint64_t
+hnd_ticks_to_ns
+(
+  uint64_t _ticks
+)
+{
+  if (!tick_clock_tsc)
+    return _ticks;
+
+  /* @note Halves multiplied apart, so long spans don't overflow */
+  return (_ticks >> 32) * tick_scale + (((_ticks & 0xffffffffull) * tick_scale) >> 32);
+}
+
+void
+hnd_init_frame_limiter
+(
+  hnd_frame_limiter_t *_limiter,
+  uint64_t             _target_ns
+)
+{
+  if (!hnd_assert(_limiter != NULL, HND_SYNTAX))
+    return;
+
+  _limiter->target_ns = _target_ns;
+  _limiter->frame_start = hnd_get_clock_ns();
+  _limiter->deadline = _limiter->frame_start + _target_ns;
+  hnd_reset_frame_stats(_limiter);
+}
+
+void
+hnd_set_frame_limit
+(
+  hnd_frame_limiter_t *_limiter,
+  uint64_t             _target_ns
+)
+{
+  if (!hnd_assert(_limiter != NULL, HND_SYNTAX))
+    return;
+
+  _limiter->target_ns = _target_ns;
+  _limiter->deadline = _limiter->frame_start + _target_ns;
+}
+
+void
+hnd_wait_frame_limiter
+(
+  hnd_frame_limiter_t *_limiter
+)
+{
+  HND_PROFILE_SCOPE("hnd_wait_frame_limiter");
+
+  if (!hnd_assert(_limiter != NULL, HND_SYNTAX))
+    return;
+
+  uint64_t work_end = hnd_get_clock_ns();
+  int missed = _limiter->target_ns && work_end >= _limiter->deadline;
+  if (missed)
+    ++_limiter->stats.missed_deadlines;
+  else if (_limiter->target_ns)
+    hnd_sleep_until_ns(_limiter->deadline);
+
+  uint64_t frame_end = hnd_get_clock_ns();
+  hnd_frame_stats_t *stats = &_limiter->stats;
+
+  stats->frame_ns = frame_end - _limiter->frame_start;
+  stats->work_ns = work_end - _limiter->frame_start;
+  if (stats->frame_ns < stats->min_frame_ns)
+    stats->min_frame_ns = stats->frame_ns;
+  if (stats->frame_ns > stats->max_frame_ns)
+    stats->max_frame_ns = stats->frame_ns;
+
+  /* @note Starts at the first frame so the average doesn't have to climb from zero */
+  stats->average_frame_ns = stats->frame_count
+    ? stats->average_frame_ns - (stats->average_frame_ns >> 4) + (stats->frame_ns >> 4)
+    : stats->frame_ns;
+  ++stats->frame_count;
+
+  /* @note On time, frames keep a fixed cadence. Late, the schedule starts over. */
+  _limiter->deadline = missed || !_limiter->target_ns
+    ? frame_end + _limiter->target_ns
+    : _limiter->deadline + _limiter->target_ns;
+  _limiter->frame_start = frame_end;
+}
+
+void
+hnd_reset_frame_stats
+(
+  hnd_frame_limiter_t *_limiter
+)
+{
+  if (!hnd_assert(_limiter != NULL, HND_SYNTAX))
+    return;
+
+  memset(&_limiter->stats, 0x00, sizeof(hnd_frame_stats_t));
+  _limiter->stats.min_frame_ns = UINT64_MAX;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file src/core/clock/linux_clock.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "clock.h"
+#include <errno.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HND_SPIN_PAUSE() __builtin_ia32_pause()
+#else
+#define HND_SPIN_PAUSE()
+#endif /* __x86_64__ || __i386__ */
+
+uint64_t
+hnd_get_clock_ns
+(
+  void
+)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * HND_NANOSECONDS_PER_SECOND + (uint64_t)now.tv_nsec;
+}
+
+void
+hnd_sleep_until_ns
+(
+  uint64_t _deadline
+)
+{
+  if (_deadline > HND_SLEEP_SPIN_THRESHOLD)
+  {
+    uint64_t wake_up = _deadline - HND_SLEEP_SPIN_THRESHOLD;
+    struct timespec sleep_deadline =
+    {
+      (time_t)(wake_up / HND_NANOSECONDS_PER_SECOND),
+      (long)(wake_up % HND_NANOSECONDS_PER_SECOND)
+    };
+
+    /* @note Absolute, so signals interrupting it don't stretch the wait */
+    while (hnd_get_clock_ns() < wake_up &&
+           clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sleep_deadline, NULL) == EINTR);
+  }
+
+  while (hnd_get_clock_ns() < _deadline)
+    HND_SPIN_PAUSE();
+}
@@ -0,0 +1,190 @@
+/**
+ * @file src/core/clock/timing.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "timing.h"
+#include <stdio.h>
+
+#define HND_TIMING_SUB_BUCKETS (1 << HND_TIMING_SUB_BUCKET_BITS)
+
+static const char *frame_timing_names[HND_FRAME_TIMING_COUNT] = { "frame", "update", "render", "swap" };
+
+static uint32_t
+hnd_get_timing_bucket
+(
+  uint64_t _microseconds
+)
+{
+  if (_microseconds < HND_TIMING_SUB_BUCKETS)
+    return (uint32_t)_microseconds;
+
+  uint32_t exponent = 63 - (uint32_t)__builtin_clzll(_microseconds);
+  uint32_t sub_bucket = (uint32_t)(_microseconds >> (exponent - HND_TIMING_SUB_BUCKET_BITS)) & (HND_TIMING_SUB_BUCKETS - 1);
+  uint32_t bucket = (exponent - HND_TIMING_SUB_BUCKET_BITS + 1) * HND_TIMING_SUB_BUCKETS + sub_bucket;
+
+  return bucket < HND_TIMING_BUCKET_COUNT ? bucket : HND_TIMING_BUCKET_COUNT - 1;
+}
+
+/**
+ * @brief Gets the middle of a bucket, in nanoseconds.
+ */
+static uint64_t
+hnd_get_timing_bucket_ns
+(
+  uint32_t _bucket
+)
+{
+  if (_bucket < HND_TIMING_SUB_BUCKETS)
+    return _bucket * HND_NANOSECONDS_PER_MICROSECOND + HND_NANOSECONDS_PER_MICROSECOND / 2;
+
+  uint32_t shift = _bucket / HND_TIMING_SUB_BUCKETS - 1;
+  uint64_t lowest = (uint64_t)(HND_TIMING_SUB_BUCKETS + _bucket % HND_TIMING_SUB_BUCKETS) << shift;
+  uint64_t width = 1ull << shift;
+
+  return lowest * HND_NANOSECONDS_PER_MICROSECOND + width * HND_NANOSECONDS_PER_MICROSECOND / 2;
+}
+
+void
+hnd_init_timing_histogram
+(
+  hnd_timing_histogram_t *_histogram,
+  uint64_t                _hitch_ns
+)
+{
+  if (!hnd_assert(_histogram != NULL, HND_SYNTAX))
+    return;
+
+  memset(_histogram, 0x00, sizeof(hnd_timing_histogram_t));
+  _histogram->hitch_ns = _hitch_ns;
+}
+
+void
+hnd_add_timing_sample
+(
+  hnd_timing_histogram_t *_histogram,
+  uint64_t                _ns
+)
+{
+  uint32_t generation = _histogram->generation;
+  if (_histogram->sample_counts[generation] >= HND_TIMING_WINDOW)
+  {
+    generation ^= 1;
+    _histogram->generation = generation;
+
+    memset(_histogram->counts[generation], 0x00, sizeof(_histogram->counts[generation]));
+    _histogram->sample_counts[generation] = 0;
+    _histogram->hitch_counts[generation] = 0;
+    _histogram->max_ns[generation] = 0;
+  }
+
+  ++_histogram->counts[generation][hnd_get_timing_bucket(_ns / HND_NANOSECONDS_PER_MICROSECOND)];
+  ++_histogram->sample_counts[generation];
+  if (_ns > _histogram->max_ns[generation])
+    _histogram->max_ns[generation] = _ns;
+  if (_histogram->hitch_ns && _ns > _histogram->hitch_ns)
+    ++_histogram->hitch_counts[generation];
+}
+
+/**
+ * @brief Finds the bucket holding the sample of a given rank, counting from 1.
+ */
+static uint64_t
+hnd_get_timing_rank_ns
+(
+  const hnd_timing_histogram_t *_histogram,
+  uint64_t                      _rank,
+  uint64_t                      _max_ns
+)
+{
+  uint64_t seen = 0;
+  for (uint32_t bucket = 0; bucket < HND_TIMING_BUCKET_COUNT; ++bucket)
+  {
+    seen += _histogram->counts[0][bucket] + _histogram->counts[1][bucket];
+    if (seen >= _rank)
+    {
+      uint64_t ns = hnd_get_timing_bucket_ns(bucket);
+
+      return ns < _max_ns ? ns : _max_ns;
+    }
+  }
+
+  return _max_ns;
+}
+
+void
+hnd_get_timing_report
+(
+  const hnd_timing_histogram_t *_histogram,
+  hnd_timing_report_t          *_report
+)
+{
+  if (!hnd_assert(_histogram != NULL && _report != NULL, HND_SYNTAX))
+    return;
+
+  memset(_report, 0x00, sizeof(hnd_timing_report_t));
+  _report->count = (uint64_t)_histogram->sample_counts[0] + _histogram->sample_counts[1];
+  _report->hitches = (uint64_t)_histogram->hitch_counts[0] + _histogram->hitch_counts[1];
+  _report->max_ns = _histogram->max_ns[0] > _histogram->max_ns[1] ? _histogram->max_ns[0] : _histogram->max_ns[1];
+  if (!_report->count)
+    return;
+
+  /* @note Nearest rank, the smallest sample with at least p% of them at or below it */
+  _report->p50_ns = hnd_get_timing_rank_ns(_histogram, (_report->count * 50 + 99) / 100, _report->max_ns);
+  _report->p95_ns = hnd_get_timing_rank_ns(_histogram, (_report->count * 95 + 99) / 100, _report->max_ns);
+  _report->p99_ns = hnd_get_timing_rank_ns(_histogram, (_report->count * 99 + 99) / 100, _report->max_ns);
+}
+
+void
+hnd_init_frame_timings
+(
+  hnd_frame_timings_t *_timings,
+  uint64_t             _hitch_ns
+)
+{
+  if (!hnd_assert(_timings != NULL, HND_SYNTAX))
+    return;
+
+  for (uint32_t i = 0; i < HND_FRAME_TIMING_COUNT; ++i)
+    hnd_init_timing_histogram(&_timings->channels[i], i == HND_FRAME_TIMING_FRAME ? _hitch_ns : 0);
+}
+
+void
+hnd_print_frame_timings
+(
+  const hnd_frame_timings_t *_timings
+)
+{
+  if (!hnd_assert(_timings != NULL, HND_SYNTAX))
+    return;
+
+  for (uint32_t i = 0; i < HND_FRAME_TIMING_COUNT; ++i)
+  {
+    hnd_timing_report_t report;
+    hnd_get_timing_report(&_timings->channels[i], &report);
+
+    printf("%-6s %6llu samples  p50 %7.3f  p95 %7.3f  p99 %7.3f  max %7.3f ms",
+           frame_timing_names[i],
+           (unsigned long long)report.count,
+           (double)report.p50_ns / 1e6,
+           (double)report.p95_ns / 1e6,
+           (double)report.p99_ns / 1e6,
+           (double)report.max_ns / 1e6);
+    if (i == HND_FRAME_TIMING_FRAME)
+      printf("  %llu hitches", (unsigned long long)report.hitches);
+    printf("\n");
+  }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file src/core/clock/timing.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Frame timing histograms. Durations are counted in log-linear microsecond buckets,
+ * 32 per power of two, so percentiles are within about 1.5% at any scale and memory
+ * doesn't grow with the number of frames.
+ */
+
+#ifndef __HND_TIMING_H__
+#define __HND_TIMING_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "clock.h"
+
+/* @note Sub buckets per power of two, as a shift */
+#define HND_TIMING_SUB_BUCKET_BITS 5
+/* @note Up to 2^26 microseconds, about a minute. Longer samples land in the last bucket. */
+#define HND_TIMING_MAX_BITS        26
+#define HND_TIMING_BUCKET_COUNT    ((HND_TIMING_MAX_BITS - HND_TIMING_SUB_BUCKET_BITS + 1) << HND_TIMING_SUB_BUCKET_BITS)
+/* @note Samples per generation, see hnd_timing_histogram_t */
+#define HND_TIMING_WINDOW          1024
+
+/* @note Default hitch threshold, two frames at 60 Hz */
+#define HND_TIMING_DEFAULT_HITCH (2 * HND_NANOSECONDS_PER_SECOND / 60)
+
+/* @note Channels of hnd_frame_timings_t */
+#define HND_FRAME_TIMING_FRAME  0
+#define HND_FRAME_TIMING_UPDATE 1
+#define HND_FRAME_TIMING_RENDER 2
+#define HND_FRAME_TIMING_SWAP   3
+#define HND_FRAME_TIMING_COUNT  4
+
+/**
+ * @brief A rolling duration histogram.
+ *
+ * @note Samples go to the current generation. Once it holds HND_TIMING_WINDOW of them the
+ * older one is cleared and takes over, so reports cover the last one to two windows.
+ */
+typedef struct hnd_timing_histogram_t
+{
+  uint32_t counts[2][HND_TIMING_BUCKET_COUNT];
+  uint32_t sample_counts[2];
+  uint32_t hitch_counts[2];
+  uint64_t max_ns[2];
+  uint32_t generation;
+
+  /* @note Samples longer than this are hitches, 0 doesn't count them */
+  uint64_t hitch_ns;
+} hnd_timing_histogram_t;
+
+typedef struct hnd_timing_report_t
+{
+  uint64_t count;
+  uint64_t p50_ns;
+  uint64_t p95_ns;
+  uint64_t p99_ns;
+  uint64_t max_ns;
+  uint64_t hitches;
+} hnd_timing_report_t;
+
+/**
+ * @brief Frame, update, render and swap durations, filled by hnd_run.
+ */
+typedef struct hnd_frame_timings_t
+{
+  hnd_timing_histogram_t channels[HND_FRAME_TIMING_COUNT];
+} hnd_frame_timings_t;
+
+void
+hnd_init_timing_histogram
+(
+  hnd_timing_histogram_t *_histogram,
+  uint64_t                _hitch_ns
+);
+
+void
+hnd_add_timing_sample
+(
+  hnd_timing_histogram_t *_histogram,
+  uint64_t                _ns
+);
+
+/**
+ * @brief Gets the percentiles of the samples in the histogram.
+ *
+ * @note Percentiles are the middle of their bucket, clamped to the max, which is exact.
+ */
+void
+hnd_get_timing_report
+(
+  const hnd_timing_histogram_t *_histogram,
+  hnd_timing_report_t          *_report
+);
+
+/**
+ * @param _timings  Specifies the timings.
+ * @param _hitch_ns Specifies the frame time counted as a hitch, e.g.
+ *                  HND_TIMING_DEFAULT_HITCH. Only the frame channel counts hitches.
+ */
+void
+hnd_init_frame_timings
+(
+  hnd_frame_timings_t *_timings,
+  uint64_t             _hitch_ns
+);
+
+/**
+ * @brief Prints a line per channel: p50, p95, p99 and max in milliseconds, and hitches.
+ */
+void
+hnd_print_frame_timings
+(
+  const hnd_frame_timings_t *_timings
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_TIMING_H__ */
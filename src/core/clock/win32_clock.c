@@ -0,0 +1,78 @@
+/**
+ * @file src/core/clock/win32_clock.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "clock.h"
+
+uint64_t
+hnd_get_clock_ns
+(
+  void
+)
+{
+  static LARGE_INTEGER frequency;
+  if (!frequency.QuadPart)
+    QueryPerformanceFrequency(&frequency);
+
+  LARGE_INTEGER now;
+  QueryPerformanceCounter(&now);
+
+  /* @note Split to keep the multiplication from overflowing */
+  uint64_t seconds = (uint64_t)now.QuadPart / (uint64_t)frequency.QuadPart;
+  uint64_t remainder = (uint64_t)now.QuadPart % (uint64_t)frequency.QuadPart;
+
+  return seconds * HND_NANOSECONDS_PER_SECOND + remainder * HND_NANOSECONDS_PER_SECOND / (uint64_t)frequency.QuadPart;
+}
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif /* CREATE_WAITABLE_TIMER_HIGH_RESOLUTION */
+
+void
+hnd_sleep_until_ns
+(
+  uint64_t _deadline
+)
+{
+  /* @note Sleep only ticks every 15.6 ms by default, high resolution timers don't. Older
+   * systems fall back to Sleep and spin for longer.
+   */
+  static HANDLE timer;
+  static int timer_ready = HND_NK;
+  if (!timer_ready)
+  {
+    timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    timer_ready = HND_OK;
+  }
+
+  uint64_t now = hnd_get_clock_ns();
+  if (now + HND_SLEEP_SPIN_THRESHOLD < _deadline)
+  {
+    uint64_t wait = _deadline - HND_SLEEP_SPIN_THRESHOLD - now;
+
+    /* @note Relative due times are negative, in 100 ns units */
+    LARGE_INTEGER due_time;
+    due_time.QuadPart = -(LONGLONG)(wait / 100);
+    if (timer && SetWaitableTimer(timer, &due_time, 0, NULL, NULL, FALSE))
+      WaitForSingleObject(timer, INFINITE);
+    else if (wait >= 2 * HND_NANOSECONDS_PER_MILLISECOND)
+      Sleep((DWORD)(wait / HND_NANOSECONDS_PER_MILLISECOND) - 1);
+  }
+
+  while (hnd_get_clock_ns() < _deadline)
+    YieldProcessor();
+}
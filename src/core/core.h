@@ -31,8 +31,10 @@ extern "C"
 #include <windows.h>
 #endif /* _WIN32 */
 #include "debug.h"
+#include "cpu.h"
 
 #include "../util/math/vector.h"
+#include "../util/math/compact_vector.h"
 
 #define HND_NAME "Hound"
 #define HND_VERSION  "0.1.0"
@@ -0,0 +1,91 @@
+/**
+ * @file src/core/cpu.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+
+/**
+ * @brief Reads the extended control register, telling which register states the OS saves.
+ *
+ * @note Written in assembly so we don't need to compile this file with -mxsave.
+ */
+static unsigned int
+hnd_get_xcr0
+(
+  void
+)
+{
+  unsigned int eax, edx;
+  __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+  return eax;
+}
+#endif /* __x86_64__ || __i386__ */
+
+unsigned int
+hnd_get_cpu_features
+(
+  void
+)
+{
+  static int queried = 0;
+  static unsigned int features = 0;
+
+  if (queried)
+    return features;
+
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+  {
+    if (edx & bit_SSE)
+      features |= HND_CPU_SSE;
+    if (edx & bit_SSE2)
+      features |= HND_CPU_SSE2;
+    if (ecx & bit_SSE3)
+      features |= HND_CPU_SSE3;
+    if (ecx & bit_SSSE3)
+      features |= HND_CPU_SSSE3;
+    if (ecx & bit_SSE4_1)
+      features |= HND_CPU_SSE41;
+
+    /* @note AVX is only usable if the OS saves the ymm registers on context switches (XCR0 bits 1 and 2). */
+    if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX) && (hnd_get_xcr0() & 0x6) == 0x6)
+    {
+      features |= HND_CPU_AVX;
+
+      if (ecx & bit_FMA)
+        features |= HND_CPU_FMA;
+      if (ecx & bit_F16C)
+        features |= HND_CPU_F16C;
+
+      if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2))
+        features |= HND_CPU_AVX2;
+    }
+  }
+
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1 << 8)))
+    features |= HND_CPU_INVARIANT_TSC;
+#endif /* __x86_64__ || __i386__ */
+
+  queried = 1;
+
+  return features;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file src/core/cpu.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#ifndef __HND_CPU_H__
+#define __HND_CPU_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* CPU features */
+#define HND_CPU_SSE    0x001
+#define HND_CPU_SSE2   0x002
+#define HND_CPU_SSE3   0x004
+#define HND_CPU_SSSE3  0x008
+#define HND_CPU_SSE41  0x010
+#define HND_CPU_AVX    0x020
+#define HND_CPU_AVX2   0x040
+#define HND_CPU_FMA    0x080
+#define HND_CPU_F16C   0x100
+
+/* @note The time stamp counter ticks at a constant rate, whatever the core's frequency and power state */
+#define HND_CPU_INVARIANT_TSC 0x200
+
+/**
+ * @brief Gets the instruction set extensions supported by both the CPU and the OS.
+ *
+ * @note The cpuid query only runs on the first call, the result is cached afterwards.
+ *
+ * @return A mask of HND_CPU_* flags. Zero on non x86 targets.
+ */
+unsigned int
+hnd_get_cpu_features
+(
+  void
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_CPU_H__ */
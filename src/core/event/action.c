@@ -0,0 +1,392 @@
+/**
+ * @file src/core/event/action.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "action.h"
+#include <math.h>
+
+#define HND_TEST_CODE(_map, _code) (((_map)->codes_down[(_code) >> 6] >> ((_code) & 63)) & 1)
+
+void
+hnd_init_action_map
+(
+  hnd_action_map_t *_map
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return;
+
+  memset(_map, 0x00, sizeof(hnd_action_map_t));
+}
+
+int
+hnd_find_action
+(
+  const hnd_action_map_t *_map,
+  const char             *_name
+)
+{
+  if (!hnd_assert(_map != NULL && _name != NULL, HND_SYNTAX))
+    return -1;
+
+  /* @note Meant for setup and rebinding, frames use the index */
+  for (uint32_t i = 0; i < _map->action_count; ++i)
+  {
+    if (!strncmp(_map->names[i], _name, HND_ACTION_NAME_SIZE))
+      return (int)i;
+  }
+
+  return -1;
+}
+
+int
+hnd_add_action
+(
+  hnd_action_map_t *_map,
+  const char       *_name
+)
+{
+  int action = hnd_find_action(_map, _name);
+  if (action >= 0)
+    return action;
+
+  if (_map->action_count == HND_MAX_ACTIONS)
+  {
+    hnd_print_debug(HND_WARNING, "Too many actions", _name);
+
+    return -1;
+  }
+
+  strncpy(_map->names[_map->action_count], _name, HND_ACTION_NAME_SIZE - 1);
+
+  return (int)_map->action_count++;
+}
+
+int
+hnd_bind_action
+(
+  hnd_action_map_t *_map,
+  int               _action,
+  uint32_t          _code,
+  uint32_t          _modifier,
+  float             _scale
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_action >= 0 && (uint32_t)_action < _map->action_count, "Unknown action"))
+    return HND_NK;
+  if (!hnd_assert(_code < HND_ACTION_CODE_COUNT &&
+                  (_modifier < HND_ACTION_CODE_COUNT || _modifier == HND_ACTION_NO_MODIFIER),
+                  "Input code out of range"))
+    return HND_NK;
+
+  if (_map->binding_count == HND_MAX_ACTION_BINDINGS)
+  {
+    hnd_print_debug(HND_WARNING, "Too many action bindings", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  _map->bindings[_map->binding_count++] =
+    (hnd_action_binding_t){ (uint16_t)_action, (uint16_t)_code, (uint16_t)_modifier, _scale };
+
+  return HND_OK;
+}
+
+int
+hnd_bind_action_axis
+(
+  hnd_action_map_t *_map,
+  int               _action,
+  uint32_t          _joystick,
+  uint32_t          _axis,
+  float             _scale
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_action >= 0 && (uint32_t)_action < _map->action_count, "Unknown action"))
+    return HND_NK;
+  if (!hnd_assert(_joystick < HND_MAX_JOYSTICKS && _axis < HND_JOYSTICK_MAX_AXES, "Axis out of range"))
+    return HND_NK;
+
+  if (_map->axis_binding_count == HND_MAX_ACTION_BINDINGS)
+  {
+    hnd_print_debug(HND_WARNING, "Too many action bindings", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  _map->axis_bindings[_map->axis_binding_count++] =
+    (hnd_action_axis_binding_t){ (uint16_t)_action, (uint8_t)_joystick, (uint8_t)_axis, _scale };
+
+  return HND_OK;
+}
+
+void
+hnd_clear_action_bindings
+(
+  hnd_action_map_t *_map,
+  int               _action
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return;
+
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < _map->binding_count; ++i)
+  {
+    if (_map->bindings[i].action != _action)
+      _map->bindings[count++] = _map->bindings[i];
+  }
+  _map->binding_count = count;
+
+  count = 0;
+  for (uint32_t i = 0; i < _map->axis_binding_count; ++i)
+  {
+    if (_map->axis_bindings[i].action != _action)
+      _map->axis_bindings[count++] = _map->axis_bindings[i];
+  }
+  _map->axis_binding_count = count;
+}
+
+void
+hnd_compile_action_map
+(
+  hnd_action_map_t *_map
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return;
+
+  /* @note Counting sort of the bindings by code, then by modifier */
+  memset(_map->code_offsets, 0x00, sizeof(_map->code_offsets));
+  memset(_map->modifier_offsets, 0x00, sizeof(_map->modifier_offsets));
+  for (uint32_t i = 0; i < _map->binding_count; ++i)
+  {
+    ++_map->code_offsets[_map->bindings[i].code + 1];
+    if (_map->bindings[i].modifier != HND_ACTION_NO_MODIFIER)
+      ++_map->modifier_offsets[_map->bindings[i].modifier + 1];
+  }
+
+  for (uint32_t code = 0; code < HND_ACTION_CODE_COUNT; ++code)
+  {
+    _map->code_offsets[code + 1] += _map->code_offsets[code];
+    _map->modifier_offsets[code + 1] += _map->modifier_offsets[code];
+  }
+
+  uint16_t code_cursors[HND_ACTION_CODE_COUNT];
+  uint16_t modifier_cursors[HND_ACTION_CODE_COUNT];
+  memcpy(code_cursors, _map->code_offsets, sizeof(code_cursors));
+  memcpy(modifier_cursors, _map->modifier_offsets, sizeof(modifier_cursors));
+  for (uint32_t i = 0; i < _map->binding_count; ++i)
+  {
+    _map->code_bindings[code_cursors[_map->bindings[i].code]++] = (uint16_t)i;
+    if (_map->bindings[i].modifier != HND_ACTION_NO_MODIFIER)
+      _map->modifier_bindings[modifier_cursors[_map->bindings[i].modifier]++] = (uint16_t)i;
+  }
+
+  /* @note Binding indices changed, start over from nothing held */
+  memset(_map->codes_down, 0x00, sizeof(_map->codes_down));
+  memset(_map->binding_active, 0x00, sizeof(_map->binding_active));
+  memset(_map->active_counts, 0x00, sizeof(_map->active_counts));
+  memset(_map->digital_values, 0x00, sizeof(_map->digital_values));
+  memset(_map->activated, 0x00, sizeof(_map->activated));
+  memset(_map->actions, 0x00, sizeof(_map->actions));
+}
+
+static void
+hnd_set_binding_active
+(
+  hnd_action_map_t *_map,
+  uint32_t          _binding,
+  int               _active
+)
+{
+  if (_map->binding_active[_binding] == _active)
+    return;
+
+  const hnd_action_binding_t *binding = &_map->bindings[_binding];
+  _map->binding_active[_binding] = (uint8_t)_active;
+
+  if (_active)
+  {
+    _map->digital_values[binding->action] += binding->scale;
+    if (!_map->active_counts[binding->action]++)
+      _map->activated[binding->action] = HND_OK;
+  }
+  else
+  {
+    _map->digital_values[binding->action] -= binding->scale;
+    --_map->active_counts[binding->action];
+  }
+}
+
+static void
+hnd_press_action_code
+(
+  hnd_action_map_t *_map,
+  uint32_t          _code
+)
+{
+  if (HND_TEST_CODE(_map, _code))
+    return;
+  _map->codes_down[_code >> 6] |= (uint64_t)1 << (_code & 63);
+
+  for (uint32_t i = _map->code_offsets[_code]; i < _map->code_offsets[_code + 1]; ++i)
+  {
+    uint32_t binding = _map->code_bindings[i];
+    uint32_t modifier = _map->bindings[binding].modifier;
+
+    if (modifier == HND_ACTION_NO_MODIFIER || HND_TEST_CODE(_map, modifier))
+      hnd_set_binding_active(_map, binding, HND_OK);
+  }
+}
+
+static void
+hnd_release_action_code
+(
+  hnd_action_map_t *_map,
+  uint32_t          _code
+)
+{
+  if (!HND_TEST_CODE(_map, _code))
+    return;
+  _map->codes_down[_code >> 6] &= ~((uint64_t)1 << (_code & 63));
+
+  /* @note Releasing a modifier breaks its chords too */
+  for (uint32_t i = _map->code_offsets[_code]; i < _map->code_offsets[_code + 1]; ++i)
+    hnd_set_binding_active(_map, _map->code_bindings[i], HND_NK);
+  for (uint32_t i = _map->modifier_offsets[_code]; i < _map->modifier_offsets[_code + 1]; ++i)
+    hnd_set_binding_active(_map, _map->modifier_bindings[i], HND_NK);
+}
+
+/**
+ * @brief Turns joystick button changes since the last frame into code presses and releases.
+ */
+static void
+hnd_update_joystick_codes
+(
+  hnd_action_map_t *_map
+)
+{
+  for (uint32_t j = 0; j < HND_MAX_JOYSTICKS; ++j)
+  {
+    const hnd_joystick_t *joystick = hnd_get_joystick(j);
+    uint32_t base = HND_ACTION_CODE_JOYSTICK_BUTTON(j, 0);
+
+    /* @note Each joystick's 32 codes sit in half a word */
+    uint32_t previous = (uint32_t)(_map->codes_down[base >> 6] >> (base & 63));
+    uint32_t current = joystick->connected ? joystick->buttons : 0;
+    uint32_t taps = joystick->connected ? joystick->pressed_buttons & ~current & ~previous : 0;
+
+    for (uint32_t changed = previous ^ current; changed; changed &= changed - 1)
+    {
+      uint32_t button = (uint32_t)__builtin_ctz(changed);
+      if ((current >> button) & 1)
+        hnd_press_action_code(_map, base + button);
+      else
+        hnd_release_action_code(_map, base + button);
+    }
+
+    for (; taps; taps &= taps - 1)
+    {
+      uint32_t button = (uint32_t)__builtin_ctz(taps);
+      hnd_press_action_code(_map, base + button);
+      hnd_release_action_code(_map, base + button);
+    }
+  }
+}
+
+void
+hnd_update_actions
+(
+  hnd_action_map_t        *_map,
+  const hnd_input_event_t *_events,
+  size_t                   _count
+)
+{
+  if (!hnd_assert(_map != NULL, HND_SYNTAX))
+    return;
+  if (!hnd_assert(_events != NULL || _count == 0, HND_SYNTAX))
+    return;
+
+  memset(_map->activated, 0x00, sizeof(_map->activated));
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const hnd_input_event_t *event = &_events[i];
+
+    switch (event->type)
+    {
+    case HND_EVENT_KEY_PRESS:
+      if (event->key.code < 256)
+        hnd_press_action_code(_map, event->key.code);
+
+      break;
+    case HND_EVENT_KEY_RELEASE:
+      if (event->key.code < 256)
+        hnd_release_action_code(_map, event->key.code);
+
+      break;
+    case HND_EVENT_MOUSE_BUTTON_PRESS:
+      if (event->button.code >= 32)
+        break;
+
+      hnd_press_action_code(_map, HND_ACTION_CODE_MOUSE_BUTTON(event->button.code));
+
+      /* @note Scrolls have no release */
+      if (event->button.code == HND_MOUSE_BUTTON_MIDDLE_UP ||
+          event->button.code == HND_MOUSE_BUTTON_MIDDLE_DOWN)
+        hnd_release_action_code(_map, HND_ACTION_CODE_MOUSE_BUTTON(event->button.code));
+
+      break;
+    case HND_EVENT_MOUSE_BUTTON_RELEASE:
+      if (event->button.code < 32)
+        hnd_release_action_code(_map, HND_ACTION_CODE_MOUSE_BUTTON(event->button.code));
+
+      break;
+    default:
+      break;
+    }
+  }
+
+  hnd_update_joystick_codes(_map);
+
+  float values[HND_MAX_ACTIONS];
+  memcpy(values, _map->digital_values, sizeof(float) * _map->action_count);
+  for (uint32_t i = 0; i < _map->axis_binding_count; ++i)
+  {
+    const hnd_action_axis_binding_t *binding = &_map->axis_bindings[i];
+    const hnd_joystick_t *joystick = hnd_get_joystick(binding->joystick);
+
+    if (joystick->connected)
+      values[binding->action] += joystick->axes[binding->axis] * binding->scale;
+  }
+
+  for (uint32_t i = 0; i < _map->action_count; ++i)
+  {
+    hnd_action_state_t *action = &_map->actions[i];
+    int was_down = action->down;
+
+    action->value = fminf(fmaxf(values[i], -1.0f), 1.0f);
+    action->down = _map->active_counts[i] > 0 || fabsf(action->value) >= HND_ACTION_AXIS_THRESHOLD;
+    action->pressed = !was_down && (action->down || _map->activated[i]);
+    action->released = !action->down && (was_down || _map->activated[i]);
+  }
+}
@@ -0,0 +1,225 @@
+/**
+ * @file src/core/event/action.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Input actions. Bindings from keys, mouse buttons, joystick buttons and axes, and
+ * chords of those with a held modifier, to game actions, declared at runtime and
+ * compiled into lookup tables indexed by input code.
+ */
+
+#ifndef __HND_ACTION_H__
+#define __HND_ACTION_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "event.h"
+#include "joystick.h"
+
+#define HND_MAX_ACTIONS         64
+#define HND_MAX_ACTION_BINDINGS 256
+#define HND_ACTION_NAME_SIZE    32
+
+/**
+ * @note Input codes, one space for every digital input. Keys use their HND_KEY_* code.
+ */
+#define HND_ACTION_CODE_MOUSE_BUTTON(_button)              (256 + (_button))
+#define HND_ACTION_CODE_JOYSTICK_BUTTON(_joystick, _button) (288 + (_joystick) * 32 + (_button))
+#define HND_ACTION_CODE_COUNT                              (288 + HND_MAX_JOYSTICKS * 32)
+
+/* @note Modifier for bindings that aren't chords */
+#define HND_ACTION_NO_MODIFIER 0xffff
+
+/* @note Analog magnitude past which an action counts as down */
+#define HND_ACTION_AXIS_THRESHOLD 0.5f
+
+typedef struct hnd_action_state_t
+{
+  /* @note Sum of the active bindings' scales and axes, clamped to [-1, 1] */
+  float value;
+  uint8_t down;
+  uint8_t pressed;
+  uint8_t released;
+} hnd_action_state_t;
+
+/**
+ * @brief A digital binding: while code is down, and modifier was already down when it
+ * was pressed, the action is down and scale is added to its value.
+ */
+typedef struct hnd_action_binding_t
+{
+  uint16_t action;
+  uint16_t code;
+  uint16_t modifier;
+  float scale;
+} hnd_action_binding_t;
+
+typedef struct hnd_action_axis_binding_t
+{
+  uint16_t action;
+  uint8_t joystick;
+  uint8_t axis;
+  float scale;
+} hnd_action_axis_binding_t;
+
+/**
+ * @brief Actions, their bindings and the tables compiled from them.
+ *
+ * @note The code and modifier tables are compressed rows: the bindings of code c are
+ * code_bindings[code_offsets[c]] up to code_bindings[code_offsets[c + 1]], so an input
+ * only ever touches its own bindings.
+ */
+typedef struct hnd_action_map_t
+{
+  char names[HND_MAX_ACTIONS][HND_ACTION_NAME_SIZE];
+  uint32_t action_count;
+
+  hnd_action_binding_t bindings[HND_MAX_ACTION_BINDINGS];
+  uint32_t binding_count;
+  hnd_action_axis_binding_t axis_bindings[HND_MAX_ACTION_BINDINGS];
+  uint32_t axis_binding_count;
+
+  /* @note Compiled, see hnd_compile_action_map */
+  uint16_t code_offsets[HND_ACTION_CODE_COUNT + 1];
+  uint16_t code_bindings[HND_MAX_ACTION_BINDINGS];
+  uint16_t modifier_offsets[HND_ACTION_CODE_COUNT + 1];
+  uint16_t modifier_bindings[HND_MAX_ACTION_BINDINGS];
+
+  /* @note Runtime state */
+  uint64_t codes_down[(HND_ACTION_CODE_COUNT + 63) / 64];
+  uint8_t binding_active[HND_MAX_ACTION_BINDINGS];
+  uint16_t active_counts[HND_MAX_ACTIONS];
+  float digital_values[HND_MAX_ACTIONS];
+  /* @note Went from no active binding to one during the frame, catches taps */
+  uint8_t activated[HND_MAX_ACTIONS];
+
+  hnd_action_state_t actions[HND_MAX_ACTIONS];
+} hnd_action_map_t;
+
+void
+hnd_init_action_map
+(
+  hnd_action_map_t *_map
+);
+
+/**
+ * @brief Adds an action, or finds it if it already exists.
+ *
+ * @return The action's index, or -1 if there are HND_MAX_ACTIONS already.
+ */
+int
+hnd_add_action
+(
+  hnd_action_map_t *_map,
+  const char       *_name
+);
+
+/**
+ * @return The action's index, or -1.
+ */
+int
+hnd_find_action
+(
+  const hnd_action_map_t *_map,
+  const char             *_name
+);
+
+/**
+ * @brief Binds an input code to an action.
+ *
+ * @param _map      Specifies the map.
+ * @param _action   Specifies the action.
+ * @param _code     Specifies a HND_KEY_* or HND_ACTION_CODE_* code.
+ * @param _modifier Specifies a code that must be held first, for chords, or
+ *                  HND_ACTION_NO_MODIFIER.
+ * @param _scale    Specifies what the binding adds to the action's value, e.g. -1 for
+ *                  the left half of an axis.
+ *
+ * @return HND_NK if out of bindings or arguments are out of range.
+ */
+int
+hnd_bind_action
+(
+  hnd_action_map_t *_map,
+  int               _action,
+  uint32_t          _code,
+  uint32_t          _modifier,
+  float             _scale
+);
+
+/**
+ * @brief Binds a joystick axis to an action, its value times _scale is added every frame.
+ */
+int
+hnd_bind_action_axis
+(
+  hnd_action_map_t *_map,
+  int               _action,
+  uint32_t          _joystick,
+  uint32_t          _axis,
+  float             _scale
+);
+
+/**
+ * @brief Removes every binding of an action, to rebind it.
+ */
+void
+hnd_clear_action_bindings
+(
+  hnd_action_map_t *_map,
+  int               _action
+);
+
+/**
+ * @brief Builds the lookup tables and resets the runtime state. Call after binding, before
+ * the next hnd_update_actions.
+ */
+void
+hnd_compile_action_map
+(
+  hnd_action_map_t *_map
+);
+
+/**
+ * @brief Updates every action from a frame's events and the joysticks, in one pass.
+ *
+ * @note Joystick state is read from hnd_get_joystick, poll them first.
+ */
+void
+hnd_update_actions
+(
+  hnd_action_map_t        *_map,
+  const hnd_input_event_t *_events,
+  size_t                   _count
+);
+
+static inline const hnd_action_state_t *
+hnd_get_action
+(
+  const hnd_action_map_t *_map,
+  int                     _action
+)
+{
+  return &_map->actions[(unsigned int)_action % HND_MAX_ACTIONS];
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_ACTION_H__ */
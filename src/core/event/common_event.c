@@ -0,0 +1,347 @@
+/**
+ * @file src/core/event/common_event.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "event.h"
+
+#define HND_EVENT_RING_MASK (HND_EVENT_RING_CAPACITY - 1)
+
+int
+hnd_push_event
+(
+  hnd_event_ring_t        *_ring,
+  const hnd_input_event_t *_event
+)
+{
+  /* @note Only the producer writes tail */
+  uint32_t tail = _ring->tail;
+  if (tail - __atomic_load_n(&_ring->head, __ATOMIC_ACQUIRE) == HND_EVENT_RING_CAPACITY)
+    return HND_NK;
+
+  _ring->events[tail & HND_EVENT_RING_MASK] = *_event;
+  __atomic_store_n(&_ring->tail, tail + 1, __ATOMIC_RELEASE);
+
+  return HND_OK;
+}
+
+int
+hnd_pop_event
+(
+  hnd_event_ring_t  *_ring,
+  hnd_input_event_t *_event
+)
+{
+  /* @note Only the consumer writes head */
+  uint32_t head = _ring->head;
+  if (__atomic_load_n(&_ring->tail, __ATOMIC_ACQUIRE) == head)
+    return HND_NK;
+
+  *_event = _ring->events[head & HND_EVENT_RING_MASK];
+  __atomic_store_n(&_ring->head, head + 1, __ATOMIC_RELEASE);
+
+  return HND_OK;
+}
+
+uint32_t
+hnd_get_event_count
+(
+  const hnd_event_ring_t *_ring
+)
+{
+  return __atomic_load_n(&_ring->tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&_ring->head, __ATOMIC_ACQUIRE);
+}
+
+void
+hnd_init_event_filter
+(
+  hnd_event_filter_t *_filter
+)
+{
+  memset(_filter, 0x00, sizeof(hnd_event_filter_t));
+
+  _filter->mask = HND_EVENT_MASK_ALL;
+  _filter->coalesce = HND_EVENT_MASK_MOUSE_MOVE | HND_EVENT_MASK_WINDOW;
+  _filter->pending.type = HND_EVENT_NONE;
+}
+
+uint32_t
+hnd_get_event_category
+(
+  uint32_t _type
+)
+{
+  switch (_type)
+  {
+  case HND_EVENT_KEY_PRESS:
+  case HND_EVENT_KEY_RELEASE:
+  case HND_EVENT_KEY_REPEAT:
+    return HND_EVENT_MASK_KEY;
+  case HND_EVENT_MOUSE_BUTTON_PRESS:
+  case HND_EVENT_MOUSE_BUTTON_RELEASE:
+    return HND_EVENT_MASK_MOUSE_BUTTON;
+  case HND_EVENT_MOUSE_MOVE:
+  case HND_EVENT_MOUSE_RAW_MOTION:
+    return HND_EVENT_MASK_MOUSE_MOVE;
+  case HND_EVENT_WINDOW_CONFIGURE:
+    return HND_EVENT_MASK_WINDOW;
+  default:
+    return 0;
+  }
+}
+
+void
+hnd_filter_event
+(
+  hnd_event_filter_t      *_filter,
+  hnd_event_ring_t        *_ring,
+  const hnd_input_event_t *_event
+)
+{
+  uint32_t category = hnd_get_event_category(_event->type);
+  if (category && !(__atomic_load_n(&_filter->mask, __ATOMIC_RELAXED) & category))
+    return;
+
+  hnd_input_event_t event = *_event;
+  if (event.type == HND_EVENT_KEY_PRESS &&
+      _filter->pending.type == HND_EVENT_KEY_RELEASE &&
+      _filter->pending.key.code == event.key.code &&
+      _filter->pending.server_time == event.server_time)
+  {
+    _filter->pending.type = HND_EVENT_NONE;
+    event.type = HND_EVENT_KEY_REPEAT;
+  }
+
+  if (event.type == HND_EVENT_KEY_PRESS || event.type == HND_EVENT_KEY_REPEAT || event.type == HND_EVENT_KEY_RELEASE)
+  {
+    if (event.key.code < 256)
+    {
+      uint64_t bit = (uint64_t)1 << (event.key.code & 63);
+      if (event.type == HND_EVENT_KEY_RELEASE)
+        _filter->held_keys[event.key.code >> 6] &= ~bit;
+      else
+        _filter->held_keys[event.key.code >> 6] |= bit;
+    }
+  }
+  else if (event.type == HND_EVENT_MOUSE_BUTTON_PRESS || event.type == HND_EVENT_MOUSE_BUTTON_RELEASE)
+  {
+    /* @note Scrolls have no release */
+    if (event.button.code < 32 &&
+        event.button.code != HND_MOUSE_BUTTON_MIDDLE_UP &&
+        event.button.code != HND_MOUSE_BUTTON_MIDDLE_DOWN)
+    {
+      uint32_t bit = (uint32_t)1 << event.button.code;
+      if (event.type == HND_EVENT_MOUSE_BUTTON_RELEASE)
+        _filter->held_buttons &= ~bit;
+      else
+        _filter->held_buttons |= bit;
+    }
+  }
+
+  if (event.type == HND_EVENT_MOUSE_MOVE)
+  {
+    /* @note The first motion has nothing to be relative to */
+    event.motion.dx = _filter->has_position ? (int16_t)(event.motion.x - _filter->last_x) : 0;
+    event.motion.dy = _filter->has_position ? (int16_t)(event.motion.y - _filter->last_y) : 0;
+
+    _filter->last_x = event.motion.x;
+    _filter->last_y = event.motion.y;
+    _filter->has_position = HND_OK;
+  }
+
+  int coalesced = (__atomic_load_n(&_filter->coalesce, __ATOMIC_RELAXED) & category) != 0;
+  if (coalesced && _filter->pending.type == event.type)
+  {
+    if (event.type == HND_EVENT_MOUSE_MOVE)
+    {
+      event.motion.dx += _filter->pending.motion.dx;
+      event.motion.dy += _filter->pending.motion.dy;
+    }
+    else if (event.type == HND_EVENT_MOUSE_RAW_MOTION)
+    {
+      event.raw_motion.dx += _filter->pending.raw_motion.dx;
+      event.raw_motion.dy += _filter->pending.raw_motion.dy;
+    }
+  }
+  else
+    hnd_flush_event_filter(_filter, _ring);
+
+  if (coalesced || event.type == HND_EVENT_KEY_RELEASE)
+    _filter->pending = event;
+  else
+    hnd_push_event(_ring, &event);
+}
+
+void
+hnd_begin_input_release
+(
+  hnd_event_filter_t *_filter,
+  uint64_t            _time
+)
+{
+  _filter->releasing = HND_OK;
+  _filter->release_time = _time;
+}
+
+int
+hnd_release_held_input
+(
+  hnd_event_filter_t *_filter,
+  hnd_event_ring_t   *_ring
+)
+{
+  if (!_filter->releasing)
+    return HND_NK;
+
+  hnd_input_event_t event;
+  memset(&event, 0x00, sizeof(event));
+  event.time = _filter->release_time;
+
+  /* @note Cleared first, a mask that drops the release would never clear it */
+  for (unsigned int word = 0; word < 4; ++word)
+  {
+    if (!_filter->held_keys[word])
+      continue;
+
+    unsigned int bit = (unsigned int)__builtin_ctzll(_filter->held_keys[word]);
+    _filter->held_keys[word] &= ~((uint64_t)1 << bit);
+
+    event.type = HND_EVENT_KEY_RELEASE;
+    event.key.code = word * 64 + bit;
+    hnd_filter_event(_filter, _ring, &event);
+
+    return HND_OK;
+  }
+
+  if (_filter->held_buttons)
+  {
+    event.type = HND_EVENT_MOUSE_BUTTON_RELEASE;
+    event.button.code = (unsigned int)__builtin_ctz(_filter->held_buttons);
+    event.button.x = _filter->last_x;
+    event.button.y = _filter->last_y;
+    _filter->held_buttons &= ~((uint32_t)1 << event.button.code);
+    hnd_filter_event(_filter, _ring, &event);
+
+    return HND_OK;
+  }
+
+  _filter->releasing = HND_NK;
+  hnd_flush_event_filter(_filter, _ring);
+
+  return HND_NK;
+}
+
+void
+hnd_flush_event_filter
+(
+  hnd_event_filter_t *_filter,
+  hnd_event_ring_t   *_ring
+)
+{
+  if (_filter->pending.type == HND_EVENT_NONE)
+    return;
+
+  hnd_push_event(_ring, &_filter->pending);
+  _filter->pending.type = HND_EVENT_NONE;
+}
+
+void
+hnd_begin_input_frame
+(
+  hnd_input_state_t *_input
+)
+{
+  memset(_input->pressed_keys, 0x00, sizeof(_input->pressed_keys));
+  memset(_input->released_keys, 0x00, sizeof(_input->released_keys));
+  _input->pressed_buttons = 0;
+  _input->released_buttons = 0;
+  _input->mouse_dx = 0.0f;
+  _input->mouse_dy = 0.0f;
+}
+
+void
+hnd_update_input_state
+(
+  hnd_input_state_t       *_input,
+  const hnd_input_event_t *_event
+)
+{
+  switch (_event->type)
+  {
+  case HND_EVENT_KEY_PRESS:
+  case HND_EVENT_KEY_RELEASE:
+  {
+    if (_event->key.code > 255)
+      break;
+
+    uint64_t bit = (uint64_t)1 << (_event->key.code & 63);
+    unsigned int word = _event->key.code >> 6;
+    if (_event->type == HND_EVENT_KEY_PRESS)
+    {
+      _input->keys[word] |= bit;
+      _input->pressed_keys[word] |= bit;
+    }
+    else
+    {
+      _input->keys[word] &= ~bit;
+      _input->released_keys[word] |= bit;
+    }
+
+  } break;
+  case HND_EVENT_MOUSE_BUTTON_PRESS:
+  case HND_EVENT_MOUSE_BUTTON_RELEASE:
+  {
+    if (_event->button.code > 31)
+      break;
+
+    uint32_t bit = (uint32_t)1 << _event->button.code;
+    _input->mouse_x = _event->button.x;
+    _input->mouse_y = _event->button.y;
+
+    if (_event->type == HND_EVENT_MOUSE_BUTTON_RELEASE)
+    {
+      _input->buttons &= ~bit;
+      _input->released_buttons |= bit;
+    }
+    else
+    {
+      /* @note Scrolls have no release to clear them */
+      if (_event->button.code != HND_MOUSE_BUTTON_MIDDLE_UP &&
+          _event->button.code != HND_MOUSE_BUTTON_MIDDLE_DOWN)
+        _input->buttons |= bit;
+      _input->pressed_buttons |= bit;
+    }
+
+  } break;
+  case HND_EVENT_MOUSE_MOVE:
+    _input->mouse_x = _event->motion.x;
+    _input->mouse_y = _event->motion.y;
+    if (!_input->raw_motion)
+    {
+      _input->mouse_dx += (float)_event->motion.dx;
+      _input->mouse_dy += (float)_event->motion.dy;
+    }
+
+    break;
+  case HND_EVENT_MOUSE_RAW_MOTION:
+    _input->mouse_dx += _event->raw_motion.dx;
+    _input->mouse_dy += _event->raw_motion.dy;
+
+    break;
+  default:
+    break;
+  }
+}
@@ -0,0 +1,159 @@
+/**
+ * @file src/core/event/common_joystick.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "joystick.h"
+#include "../../core/cpu.h"
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_JOYSTICK_X86
+#endif /* __x86_64__ || __i386__ */
+
+typedef void (*hnd_normalize_axes_kernel_t)(const int32_t *, const float *, const float *, const float *, float *, size_t, size_t);
+
+/* @note Scalar fallback, also used for the tails of the SIMD kernels */
+static void
+hnd_normalize_axes_scalar
+(
+  const int32_t *_raw,
+  const float   *_center,
+  const float   *_scale,
+  const float   *_deadzone,
+  float         *_axes,
+  size_t         _first,
+  size_t         _count
+)
+{
+  for (size_t i = _first; i < _count; ++i)
+  {
+    float value = fminf(fmaxf(((float)_raw[i] - _center[i]) * _scale[i], -1.0f), 1.0f);
+    float magnitude = fmaxf(fabsf(value) - _deadzone[i], 0.0f) / (1.0f - _deadzone[i]);
+
+    _axes[i] = copysignf(magnitude, value);
+  }
+}
+
+#ifdef HND_JOYSTICK_X86
+/* @note SSE2 kernel, 4 axes per iteration */
+__attribute__((target("sse2"))) static void
+hnd_normalize_axes_sse2
+(
+  const int32_t *_raw,
+  const float   *_center,
+  const float   *_scale,
+  const float   *_deadzone,
+  float         *_axes,
+  size_t         _first,
+  size_t         _count
+)
+{
+  const __m128 sign_mask = _mm_set1_ps(-0.0f);
+  const __m128 one = _mm_set1_ps(1.0f);
+
+  size_t i = _first;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 value = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(_raw + i)));
+    value = _mm_mul_ps(_mm_sub_ps(value, _mm_loadu_ps(_center + i)), _mm_loadu_ps(_scale + i));
+    value = _mm_min_ps(_mm_max_ps(value, _mm_sub_ps(_mm_setzero_ps(), one)), one);
+
+    __m128 deadzone = _mm_loadu_ps(_deadzone + i);
+    __m128 magnitude = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(sign_mask, value), deadzone), _mm_setzero_ps());
+    magnitude = _mm_div_ps(magnitude, _mm_sub_ps(one, deadzone));
+
+    _mm_storeu_ps(_axes + i, _mm_or_ps(magnitude, _mm_and_ps(sign_mask, value)));
+  }
+
+  hnd_normalize_axes_scalar(_raw, _center, _scale, _deadzone, _axes, i, _count);
+}
+
+/* @note AVX2 kernel, 8 axes per iteration, a whole joystick at once */
+__attribute__((target("avx2"))) static void
+hnd_normalize_axes_avx2
+(
+  const int32_t *_raw,
+  const float   *_center,
+  const float   *_scale,
+  const float   *_deadzone,
+  float         *_axes,
+  size_t         _first,
+  size_t         _count
+)
+{
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 one = _mm256_set1_ps(1.0f);
+
+  size_t i = _first;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 value = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(_raw + i)));
+    value = _mm256_mul_ps(_mm256_sub_ps(value, _mm256_loadu_ps(_center + i)), _mm256_loadu_ps(_scale + i));
+    value = _mm256_min_ps(_mm256_max_ps(value, _mm256_sub_ps(_mm256_setzero_ps(), one)), one);
+
+    __m256 deadzone = _mm256_loadu_ps(_deadzone + i);
+    __m256 magnitude = _mm256_max_ps(_mm256_sub_ps(_mm256_andnot_ps(sign_mask, value), deadzone), _mm256_setzero_ps());
+    magnitude = _mm256_div_ps(magnitude, _mm256_sub_ps(one, deadzone));
+
+    _mm256_storeu_ps(_axes + i, _mm256_or_ps(magnitude, _mm256_and_ps(sign_mask, value)));
+  }
+
+  hnd_normalize_axes_sse2(_raw, _center, _scale, _deadzone, _axes, i, _count);
+}
+#endif /* HND_JOYSTICK_X86 */
+
+static hnd_normalize_axes_kernel_t normalize_axes = hnd_normalize_axes_scalar;
+
+void
+hnd_select_joystick_kernels
+(
+  unsigned int _features
+)
+{
+  normalize_axes = hnd_normalize_axes_scalar;
+
+#ifdef HND_JOYSTICK_X86
+  if (_features & HND_CPU_AVX2)
+    normalize_axes = hnd_normalize_axes_avx2;
+  else if (_features & HND_CPU_SSE2)
+    normalize_axes = hnd_normalize_axes_sse2;
+#endif /* HND_JOYSTICK_X86 */
+}
+
+__attribute__((constructor)) static void
+hnd_init_joystick_kernels
+(
+  void
+)
+{
+  hnd_select_joystick_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_normalize_joystick_axes
+(
+  const int32_t *_raw,
+  const float   *_center,
+  const float   *_scale,
+  const float   *_deadzone,
+  float         *_axes,
+  size_t         _count
+)
+{
+  normalize_axes(_raw, _center, _scale, _deadzone, _axes, 0, _count);
+}
@@ -0,0 +1,202 @@
+/**
+ * @file src/core/event/common_record.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "record.h"
+
+int
+hnd_start_recording
+(
+  hnd_recorder_t *_recorder,
+  const char     *_path
+)
+{
+  if (!hnd_assert(_recorder != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_path != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  memset(_recorder, 0x00, sizeof(hnd_recorder_t));
+
+  _recorder->file = fopen(_path, "wb");
+  if (!_recorder->file)
+  {
+    hnd_print_debug(HND_WARNING, "Could not create the recording", _path);
+
+    return HND_NK;
+  }
+
+  /* @note Rewritten with the real counts by hnd_stop_recording */
+  hnd_recording_header_t header = { HND_RECORDING_MAGIC, HND_RECORDING_VERSION, sizeof(hnd_input_record_t), 0, 0, 0 };
+  fwrite(&header, sizeof(header), 1, _recorder->file);
+
+  return HND_OK;
+}
+
+void
+hnd_record_events
+(
+  hnd_recorder_t          *_recorder,
+  const hnd_input_event_t *_events,
+  size_t                   _count
+)
+{
+  if (!_recorder || !_recorder->file)
+    return;
+
+  /* @note stdio buffers the writes, one record at a time is fine */
+  hnd_input_record_t record;
+  memset(&record, 0x00, sizeof(record));
+  record.frame = _recorder->frame;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    record.event = _events[i];
+    _recorder->count += fwrite(&record, sizeof(record), 1, _recorder->file);
+  }
+}
+
+void
+hnd_end_recorder_frame
+(
+  hnd_recorder_t *_recorder
+)
+{
+  if (!_recorder || !_recorder->file)
+    return;
+
+  ++_recorder->frame;
+}
+
+void
+hnd_stop_recording
+(
+  hnd_recorder_t *_recorder
+)
+{
+  if (!_recorder || !_recorder->file)
+    return;
+
+  hnd_recording_header_t header =
+  {
+    HND_RECORDING_MAGIC,
+    HND_RECORDING_VERSION,
+    sizeof(hnd_input_record_t),
+    0,
+    _recorder->count,
+    _recorder->frame
+  };
+  fseek(_recorder->file, 0, SEEK_SET);
+  fwrite(&header, sizeof(header), 1, _recorder->file);
+
+  fclose(_recorder->file);
+  _recorder->file = NULL;
+}
+
+/**
+ * @brief Checks the header of a freshly mapped recording and points the replay at its
+ * records.
+ *
+ * @note Called by the platform's hnd_open_replay.
+ */
+int
+hnd_read_replay_header
+(
+  hnd_replay_t *_replay
+)
+{
+  const hnd_recording_header_t *header = (const hnd_recording_header_t *)_replay->mapping;
+  if (_replay->mapping_size < sizeof(hnd_recording_header_t) ||
+      header->magic != HND_RECORDING_MAGIC ||
+      header->version != HND_RECORDING_VERSION ||
+      header->record_size != sizeof(hnd_input_record_t))
+  {
+    hnd_print_debug(HND_WARNING, "Not a recording", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  /* @note A recording that wasn't stopped still has a zeroed header, trust the size */
+  uint64_t count = (_replay->mapping_size - sizeof(hnd_recording_header_t)) / sizeof(hnd_input_record_t);
+  if (header->count && header->count < count)
+    count = header->count;
+
+  _replay->records = (const hnd_input_record_t *)(header + 1);
+  _replay->count = count;
+  _replay->frames = header->frames;
+  if (count && _replay->frames <= _replay->records[count - 1].frame)
+    _replay->frames = _replay->records[count - 1].frame + 1;
+
+  _replay->next = 0;
+  _replay->frame = 0;
+
+  return HND_OK;
+}
+
+size_t
+hnd_next_replay_frame
+(
+  hnd_replay_t              *_replay,
+  const hnd_input_record_t **_records
+)
+{
+  if (!hnd_assert(_replay != NULL && _records != NULL, HND_SYNTAX))
+    return 0;
+
+  uint64_t first = _replay->next;
+  while (_replay->next < _replay->count && _replay->records[_replay->next].frame <= _replay->frame)
+    ++_replay->next;
+
+  *_records = _replay->records + first;
+  ++_replay->frame;
+
+  return (size_t)(_replay->next - first);
+}
+
+size_t
+hnd_poll_replay_batch
+(
+  hnd_replay_t      *_replay,
+  hnd_input_event_t *_events,
+  size_t             _capacity
+)
+{
+  if (!hnd_assert(_replay != NULL, HND_SYNTAX))
+    return 0;
+  if (!hnd_assert(_events != NULL || _capacity == 0, HND_SYNTAX))
+    return 0;
+
+  size_t count = 0;
+  while (count < _capacity &&
+         _replay->next < _replay->count &&
+         _replay->records[_replay->next].frame <= _replay->frame)
+    _events[count++] = _replay->records[_replay->next++].event;
+
+  if (_replay->next == _replay->count || _replay->records[_replay->next].frame > _replay->frame)
+    ++_replay->frame;
+
+  return count;
+}
+
+int
+hnd_is_replay_done
+(
+  const hnd_replay_t *_replay
+)
+{
+  return _replay->frame >= _replay->frames;
+}
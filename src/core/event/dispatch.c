@@ -0,0 +1,177 @@
+/**
+ * @file src/core/event/dispatch.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "dispatch.h"
+
+void
+hnd_init_event_dispatcher
+(
+  hnd_event_dispatcher_t *_dispatcher
+)
+{
+  if (!hnd_assert(_dispatcher != NULL, HND_SYNTAX))
+    return;
+
+  memset(_dispatcher, 0x00, sizeof(hnd_event_dispatcher_t));
+}
+
+int
+hnd_subscribe_event
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _type,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+)
+{
+  if (!hnd_assert(_dispatcher != NULL && _handler != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_type != HND_EVENT_NONE && _type < HND_EVENT_TYPE_COUNT, "Unknown event type"))
+    return HND_NK;
+
+  uint32_t count = _dispatcher->handler_counts[_type];
+  if (count == HND_MAX_EVENT_HANDLERS)
+  {
+    hnd_print_debug(HND_WARNING, "Too many handlers for an event type", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  _dispatcher->handlers[_type][count] = (hnd_event_subscriber_t){ _handler, _data };
+  _dispatcher->handler_counts[_type] = count + 1;
+
+  return HND_OK;
+}
+
+void
+hnd_unsubscribe_event
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _type,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+)
+{
+  if (!hnd_assert(_dispatcher != NULL, HND_SYNTAX))
+    return;
+  if (_type >= HND_EVENT_TYPE_COUNT)
+    return;
+
+  hnd_event_subscriber_t *handlers = _dispatcher->handlers[_type];
+  uint32_t count = _dispatcher->handler_counts[_type];
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    if (handlers[i].handler != _handler || handlers[i].data != _data)
+      continue;
+
+    /* @note Keeps the order the rest subscribed in */
+    memmove(&handlers[i], &handlers[i + 1], (count - i - 1) * sizeof(hnd_event_subscriber_t));
+    _dispatcher->handler_counts[_type] = count - 1;
+
+    return;
+  }
+}
+
+int
+hnd_subscribe_key
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _key,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+)
+{
+  if (!hnd_assert(_dispatcher != NULL && _handler != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_key < HND_DISPATCH_KEY_COUNT, "Key code out of range"))
+    return HND_NK;
+
+  if (!_dispatcher->key_handlers[_key].handler)
+    ++_dispatcher->key_handler_count;
+  _dispatcher->key_handlers[_key] = (hnd_event_subscriber_t){ _handler, _data };
+
+  return HND_OK;
+}
+
+void
+hnd_unsubscribe_key
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _key
+)
+{
+  if (!hnd_assert(_dispatcher != NULL, HND_SYNTAX))
+    return;
+  if (_key >= HND_DISPATCH_KEY_COUNT || !_dispatcher->key_handlers[_key].handler)
+    return;
+
+  --_dispatcher->key_handler_count;
+  _dispatcher->key_handlers[_key] = (hnd_event_subscriber_t){ NULL, NULL };
+}
+
+uint32_t
+hnd_get_dispatcher_mask
+(
+  const hnd_event_dispatcher_t *_dispatcher
+)
+{
+  if (!hnd_assert(_dispatcher != NULL, HND_SYNTAX))
+    return HND_EVENT_MASK_ALL;
+
+  uint32_t mask = _dispatcher->key_handler_count ? HND_EVENT_MASK_KEY : 0;
+  for (uint32_t type = 0; type < HND_EVENT_TYPE_COUNT; ++type)
+  {
+    if (_dispatcher->handler_counts[type])
+      mask |= hnd_get_event_category(type);
+  }
+
+  return mask;
+}
+
+void
+hnd_dispatch_events
+(
+  const hnd_event_dispatcher_t *_dispatcher,
+  const hnd_input_event_t      *_events,
+  size_t                        _count
+)
+{
+  if (!hnd_assert(_dispatcher != NULL, HND_SYNTAX))
+    return;
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const hnd_input_event_t *event = &_events[i];
+    if (event->type >= HND_EVENT_TYPE_COUNT)
+      continue;
+
+    const hnd_event_subscriber_t *handlers = _dispatcher->handlers[event->type];
+    for (uint32_t j = 0; j < _dispatcher->handler_counts[event->type]; ++j)
+      handlers[j].handler(event, handlers[j].data);
+
+    if ((event->type == HND_EVENT_KEY_PRESS   ||
+         event->type == HND_EVENT_KEY_RELEASE ||
+         event->type == HND_EVENT_KEY_REPEAT) &&
+        event->key.code < HND_DISPATCH_KEY_COUNT)
+    {
+      const hnd_event_subscriber_t *key_handler = &_dispatcher->key_handlers[event->key.code];
+      if (key_handler->handler)
+        key_handler->handler(event, key_handler->data);
+    }
+  }
+}
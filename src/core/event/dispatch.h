@@ -0,0 +1,149 @@
+/**
+ * @file src/core/event/dispatch.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Event dispatch. Handlers subscribe to an event type, or to a single key, and
+ * hnd_dispatch_events calls them straight out of flat tables, instead of every system
+ * branching over every event.
+ */
+
+#ifndef __HND_DISPATCH_H__
+#define __HND_DISPATCH_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "event.h"
+
+/* @note One past the last HND_EVENT_* type */
+#define HND_EVENT_TYPE_COUNT 10
+
+#define HND_MAX_EVENT_HANDLERS 8
+
+/* @note Key handlers are indexed by key code, codes above this are only seen by type handlers */
+#define HND_DISPATCH_KEY_COUNT 256
+
+typedef void (*hnd_event_handler_t)(const hnd_input_event_t *_event, void *_data);
+
+typedef struct hnd_event_subscriber_t
+{
+  hnd_event_handler_t handler;
+  void *data;
+} hnd_event_subscriber_t;
+
+/**
+ * @brief Handlers per event type and per key.
+ *
+ * @note Type handlers run in subscription order, then the key's handler.
+ */
+typedef struct hnd_event_dispatcher_t
+{
+  hnd_event_subscriber_t handlers[HND_EVENT_TYPE_COUNT][HND_MAX_EVENT_HANDLERS];
+  uint32_t handler_counts[HND_EVENT_TYPE_COUNT];
+
+  hnd_event_subscriber_t key_handlers[HND_DISPATCH_KEY_COUNT];
+  uint32_t key_handler_count;
+} hnd_event_dispatcher_t;
+
+void
+hnd_init_event_dispatcher
+(
+  hnd_event_dispatcher_t *_dispatcher
+);
+
+/**
+ * @brief Subscribes a handler to every event of a type.
+ *
+ * @param _dispatcher Specifies the dispatcher.
+ * @param _type       Specifies the HND_EVENT_* type.
+ * @param _handler    Specifies the handler.
+ * @param _data       Specifies what's handed to the handler along with the event.
+ *
+ * @return HND_NK if the type is unknown or already has HND_MAX_EVENT_HANDLERS.
+ */
+int
+hnd_subscribe_event
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _type,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+);
+
+/**
+ * @brief Removes a handler subscribed with the same data.
+ */
+void
+hnd_unsubscribe_event
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _type,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+);
+
+/**
+ * @brief Subscribes a handler to a key's press, repeat and release events. A key has a
+ * single handler, subscribing again replaces it.
+ *
+ * @return HND_NK if the key code is out of range.
+ */
+int
+hnd_subscribe_key
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _key,
+  hnd_event_handler_t     _handler,
+  void                   *_data
+);
+
+void
+hnd_unsubscribe_key
+(
+  hnd_event_dispatcher_t *_dispatcher,
+  uint32_t                _key
+);
+
+/**
+ * @brief Gets the HND_EVENT_MASK_* categories somebody listens to.
+ *
+ * @note Hand it to hnd_set_window_event_filter and the rest is dropped before it's
+ * even translated.
+ */
+uint32_t
+hnd_get_dispatcher_mask
+(
+  const hnd_event_dispatcher_t *_dispatcher
+);
+
+/**
+ * @brief Calls the handlers of every event, in order.
+ */
+void
+hnd_dispatch_events
+(
+  const hnd_event_dispatcher_t *_dispatcher,
+  const hnd_input_event_t      *_events,
+  size_t                        _count
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_DISPATCH_H__ */
@@ -26,6 +26,7 @@ extern "C"
 
 #include "../../core/core.h"
 #include "../../video/video.h"
+#include <stdint.h>
 
 #ifdef HND_WIN32
 #include "win32_event.h"
@@ -46,6 +47,368 @@ typedef hnd_linux_event_t hnd_event_t;
 #define HND_EVENT_MOUSE_BUTTON_PRESS      4
 #define HND_EVENT_MOUSE_BUTTON_RELEASE    5
 
+/* @note Window */
+#define HND_EVENT_WINDOW_CLOSE     6
+#define HND_EVENT_WINDOW_CONFIGURE 7
+
+/* @note A held key repeating, not a new press */
+#define HND_EVENT_KEY_REPEAT 8
+
+/* @note Unaccelerated pointer device movement, see hnd_set_window_relative_mouse */
+#define HND_EVENT_MOUSE_RAW_MOTION 9
+
+/* @note Keep HND_EVENT_TYPE_COUNT, in dispatch.h, one past the last type */
+
+/* @note Event categories, see hnd_event_filter_t. Closing is always reported. */
+#define HND_EVENT_MASK_KEY          0x01
+#define HND_EVENT_MASK_MOUSE_BUTTON 0x02
+#define HND_EVENT_MASK_MOUSE_MOVE   0x04
+#define HND_EVENT_MASK_WINDOW       0x08
+#define HND_EVENT_MASK_ALL          0x0f
+
+/* @note Events a window can hold between polls, power of two */
+#define HND_EVENT_RING_CAPACITY 256
+
+/**
+ * @brief Compact input event, 24 bytes.
+ *
+ * @note Read the member matching the type: key for HND_EVENT_KEY_* (repeats included), button for
+ * HND_EVENT_MOUSE_BUTTON_*, motion for HND_EVENT_MOUSE_MOVE, raw_motion for
+ * HND_EVENT_MOUSE_RAW_MOTION and configure for HND_EVENT_WINDOW_CONFIGURE.
+ *
+ * @note motion.dx and motion.dy are the movement since the previous motion event,
+ * summed over every event coalesced into this one. raw_motion is in device units,
+ * before pointer acceleration, with the fraction kept. Coalescing sums it the same way.
+ *
+ * @note time is hnd_get_clock_ns when the event was read, server_time the
+ * timestamp the display server gave it, in milliseconds, or 0 if it gave none.
+ */
+typedef struct hnd_input_event_t
+{
+  uint32_t type;
+  uint32_t server_time;
+  uint64_t time;
+
+  union
+  {
+    struct
+    {
+      uint32_t code;
+    } key;
+
+    struct
+    {
+      uint32_t code;
+      int16_t x;
+      int16_t y;
+    } button;
+
+    struct
+    {
+      int16_t x;
+      int16_t y;
+      int16_t dx;
+      int16_t dy;
+    } motion;
+
+    struct
+    {
+      float dx;
+      float dy;
+    } raw_motion;
+
+    struct
+    {
+      int16_t x;
+      int16_t y;
+      uint16_t width;
+      uint16_t height;
+    } configure;
+  };
+} hnd_input_event_t;
+
+/**
+ * @brief Fixed size queue of input events, owned by a window.
+ *
+ * @note head and tail only ever grow, their difference is the event count.
+ *
+ * @note Lock free with one thread pushing and one popping, like the input thread
+ * and the main loop. head and tail sit on different cache lines so the two don't
+ * keep stealing each other's line.
+ */
+typedef struct hnd_event_ring_t
+{
+  hnd_input_event_t events[HND_EVENT_RING_CAPACITY];
+
+  uint32_t head;
+  char head_padding[64 - sizeof(uint32_t)];
+  uint32_t tail;
+  char tail_padding[64 - sizeof(uint32_t)];
+} hnd_event_ring_t;
+
+/**
+ * @brief Producer side stage between translated events and the ring: drops masked out
+ * categories and merges runs of the same coalesced category into their latest event.
+ *
+ * @note X11 autorepeat sends a release and a press with the same timestamp. Releases
+ * wait for the next event so such pairs become a single HND_EVENT_KEY_REPEAT.
+ *
+ * @note Touched only by whoever pushes into the ring, except mask and coalesce, which
+ * may be changed from anywhere.
+ */
+typedef struct hnd_event_filter_t
+{
+  uint32_t mask;
+  uint32_t coalesce;
+
+  /* @note Held back until an event of another type shows up, HND_EVENT_NONE if empty */
+  hnd_input_event_t pending;
+
+  int16_t last_x;
+  int16_t last_y;
+  int has_position;
+
+  /* @note What went through pressed and not released, see hnd_release_held_input */
+  uint64_t held_keys[4];
+  uint32_t held_buttons;
+  uint64_t release_time;
+  int releasing;
+} hnd_event_filter_t;
+
+/* @note Free slots hnd_filter_event may need, keep this many before calling it */
+#define HND_EVENT_FILTER_SLOTS 2
+
+/**
+ * @brief Initializes a filter that passes everything and coalesces motion and window
+ * events.
+ */
+void
+hnd_init_event_filter
+(
+  hnd_event_filter_t *_filter
+);
+
+/**
+ * @brief Gets the HND_EVENT_MASK_* category of an event type.
+ */
+uint32_t
+hnd_get_event_category
+(
+  uint32_t _type
+);
+
+/**
+ * @brief Runs an event through the filter, into the ring.
+ *
+ * @note Coalesced events stay pending, call hnd_flush_event_filter once the source
+ * is drained.
+ *
+ * @param _filter Specifies the filter.
+ * @param _ring   Specifies the ring, with at least HND_EVENT_FILTER_SLOTS free.
+ * @param _event  Specifies the event.
+ */
+void
+hnd_filter_event
+(
+  hnd_event_filter_t      *_filter,
+  hnd_event_ring_t        *_ring,
+  const hnd_input_event_t *_event
+);
+
+/**
+ * @brief Starts releasing every key and button still held, see hnd_release_held_input.
+ *
+ * @note For focus loss: the display server doesn't report releases that happen while the
+ * window is unfocused, so without them keys would stay down for good.
+ *
+ * @param _filter Specifies the filter.
+ * @param _time   Specifies the releases' timestamp.
+ */
+void
+hnd_begin_input_release
+(
+  hnd_event_filter_t *_filter,
+  uint64_t            _time
+);
+
+/**
+ * @brief Filters the release of one key or button left by hnd_begin_input_release.
+ *
+ * @note One at a time so the producer can keep HND_EVENT_FILTER_SLOTS free before each,
+ * like any other event, instead of losing releases to a full ring. Producers call it
+ * before taking their next event, so the releases stay in order.
+ *
+ * @param _filter Specifies the filter.
+ * @param _ring   Specifies the ring, with HND_EVENT_FILTER_SLOTS free.
+ *
+ * @return HND_NK once nothing is left to release, after flushing the filter.
+ */
+int
+hnd_release_held_input
+(
+  hnd_event_filter_t *_filter,
+  hnd_event_ring_t   *_ring
+);
+
+/**
+ * @brief Pushes the pending event, if any.
+ *
+ * @param _filter Specifies the filter.
+ * @param _ring   Specifies the ring, with at least one slot free.
+ */
+void
+hnd_flush_event_filter
+(
+  hnd_event_filter_t *_filter,
+  hnd_event_ring_t   *_ring
+);
+
+/**
+ * @brief Keyboard and mouse state, kept up to date by hnd_poll_event_batch.
+ *
+ * @note The pressed and released sets hold every edge seen during the frame's polls, so a
+ * key tapped within a single frame shows up in both.
+ *
+ * @note mouse_dx and mouse_dy sum the movement seen during the frame, for camera control.
+ * Once raw_motion is set they come from HND_EVENT_MOUSE_RAW_MOTION only, so the same
+ * movement isn't counted twice.
+ */
+typedef struct hnd_input_state_t
+{
+  uint64_t keys[4];
+  uint64_t pressed_keys[4];
+  uint64_t released_keys[4];
+
+  uint32_t buttons;
+  uint32_t pressed_buttons;
+  uint32_t released_buttons;
+
+  int16_t mouse_x;
+  int16_t mouse_y;
+  float mouse_dx;
+  float mouse_dy;
+  int raw_motion;
+} hnd_input_state_t;
+
+/**
+ * @brief Clears the per frame edges.
+ *
+ * @note Called by hnd_poll_event_batch before handing out events.
+ */
+void
+hnd_begin_input_frame
+(
+  hnd_input_state_t *_input
+);
+
+/**
+ * @brief Applies an event to the state.
+ */
+void
+hnd_update_input_state
+(
+  hnd_input_state_t       *_input,
+  const hnd_input_event_t *_event
+);
+
+/* @note Bit tests, _key is below 256 and _button below 32 */
+static inline int
+hnd_key_down
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _key
+)
+{
+  return (int)((_input->keys[(_key >> 6) & 3] >> (_key & 63)) & 1);
+}
+
+static inline int
+hnd_key_pressed_this_frame
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _key
+)
+{
+  return (int)((_input->pressed_keys[(_key >> 6) & 3] >> (_key & 63)) & 1);
+}
+
+static inline int
+hnd_key_released_this_frame
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _key
+)
+{
+  return (int)((_input->released_keys[(_key >> 6) & 3] >> (_key & 63)) & 1);
+}
+
+/* @note Scrolls only ever show up as pressed this frame */
+static inline int
+hnd_button_down
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _button
+)
+{
+  return (int)((_input->buttons >> (_button & 31)) & 1);
+}
+
+static inline int
+hnd_button_pressed_this_frame
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _button
+)
+{
+  return (int)((_input->pressed_buttons >> (_button & 31)) & 1);
+}
+
+static inline int
+hnd_button_released_this_frame
+(
+  const hnd_input_state_t *_input,
+  unsigned int             _button
+)
+{
+  return (int)((_input->released_buttons >> (_button & 31)) & 1);
+}
+
+/**
+ * @brief Queues an event.
+ *
+ * @param _ring  Specifies the ring.
+ * @param _event Specifies the event to copy in.
+ *
+ * @return HND_NK if the ring is full.
+ */
+int
+hnd_push_event
+(
+  hnd_event_ring_t        *_ring,
+  const hnd_input_event_t *_event
+);
+
+/**
+ * @brief Dequeues the oldest event.
+ *
+ * @param _ring  Specifies the ring.
+ * @param _event Returns the event.
+ *
+ * @return HND_NK if the ring is empty.
+ */
+int
+hnd_pop_event
+(
+  hnd_event_ring_t  *_ring,
+  hnd_input_event_t *_event
+);
+
+uint32_t
+hnd_get_event_count
+(
+  const hnd_event_ring_t *_ring
+);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
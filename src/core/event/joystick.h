@@ -0,0 +1,226 @@
+/**
+ * @file src/core/event/joystick.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Gamepads and joysticks. On linux they're read straight from evdev, without
+ * blocking, and plugged in or out at any time.
+ */
+
+#ifndef __HND_JOYSTICK_H__
+#define __HND_JOYSTICK_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../../core/core.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define HND_MAX_JOYSTICKS     8
+#define HND_JOYSTICK_MAX_AXES 8
+
+/* @note Used when the device doesn't report one */
+#define HND_JOYSTICK_DEFAULT_DEADZONE 0.1f
+
+/**
+ * @note Axes. Sticks and hats go from -1 to 1, triggers from 0 to 1.
+ */
+#define HND_JOYSTICK_AXIS_LEFT_X         0
+#define HND_JOYSTICK_AXIS_LEFT_Y         1
+#define HND_JOYSTICK_AXIS_LEFT_TRIGGER   2
+#define HND_JOYSTICK_AXIS_RIGHT_X        3
+#define HND_JOYSTICK_AXIS_RIGHT_Y        4
+#define HND_JOYSTICK_AXIS_RIGHT_TRIGGER  5
+#define HND_JOYSTICK_AXIS_HAT_X          6
+#define HND_JOYSTICK_AXIS_HAT_Y          7
+
+/**
+ * @note Buttons, numbered from evdev's BTN_JOYSTICK. Plain joysticks use 0 to 15.
+ */
+#define HND_JOYSTICK_BUTTON_SOUTH          16
+#define HND_JOYSTICK_BUTTON_EAST           17
+#define HND_JOYSTICK_BUTTON_C              18
+#define HND_JOYSTICK_BUTTON_NORTH          19
+#define HND_JOYSTICK_BUTTON_WEST           20
+#define HND_JOYSTICK_BUTTON_Z              21
+#define HND_JOYSTICK_BUTTON_LEFT_BUMPER    22
+#define HND_JOYSTICK_BUTTON_RIGHT_BUMPER   23
+#define HND_JOYSTICK_BUTTON_LEFT_TRIGGER   24
+#define HND_JOYSTICK_BUTTON_RIGHT_TRIGGER  25
+#define HND_JOYSTICK_BUTTON_SELECT         26
+#define HND_JOYSTICK_BUTTON_START          27
+#define HND_JOYSTICK_BUTTON_MODE           28
+#define HND_JOYSTICK_BUTTON_LEFT_THUMB     29
+#define HND_JOYSTICK_BUTTON_RIGHT_THUMB    30
+
+/**
+ * @brief Joystick state, kept up to date by hnd_poll_joysticks.
+ *
+ * @note Mirrors hnd_input_state_t: the pressed and released sets hold every edge seen
+ * by the last poll.
+ */
+typedef struct hnd_joystick_t
+{
+  int connected;
+  char name[64];
+
+  uint32_t buttons;
+  uint32_t pressed_buttons;
+  uint32_t released_buttons;
+
+  float axes[HND_JOYSTICK_MAX_AXES];
+} hnd_joystick_t;
+
+/**
+ * @brief Selects the kernels used by hnd_normalize_joystick_axes.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_joystick_kernels
+(
+  unsigned int _features
+);
+
+/**
+ * @brief Maps raw axis values to [-1, 1], with a deadzone.
+ *
+ * @note Values become (raw - center) * scale, clamped. Magnitudes below the deadzone
+ * become 0 and the rest is rescaled so the output still starts at 0 past it.
+ *
+ * @param _raw      Specifies the raw values.
+ * @param _center   Specifies the value each axis rests at.
+ * @param _scale    Specifies 1 over each axis' half range, or range for triggers.
+ * @param _deadzone Specifies each axis' deadzone, below 1.
+ * @param _axes     Returns the normalized values.
+ * @param _count    Specifies how many axes there are.
+ */
+void
+hnd_normalize_joystick_axes
+(
+  const int32_t *_raw,
+  const float   *_center,
+  const float   *_scale,
+  const float   *_deadzone,
+  float         *_axes,
+  size_t         _count
+);
+
+/**
+ * @brief Finds the connected joysticks and starts watching for new ones.
+ *
+ * @return HND_NK if joysticks aren't available, the other functions keep working.
+ */
+int
+hnd_init_joysticks
+(
+  void
+);
+
+void
+hnd_end_joysticks
+(
+  void
+);
+
+/**
+ * @brief Reads whatever the joysticks sent since the last call, and handles plugging.
+ *
+ * @note Never blocks. Call it once per frame, so the pressed and released edges cover
+ * a frame.
+ */
+void
+hnd_poll_joysticks
+(
+  void
+);
+
+/**
+ * @brief Gets a joystick's state.
+ *
+ * @param _index Specifies the joystick, below HND_MAX_JOYSTICKS.
+ *
+ * @return The state, check connected, or NULL if _index is out of range.
+ */
+const hnd_joystick_t *
+hnd_get_joystick
+(
+  unsigned int _index
+);
+
+/**
+ * @brief Sets an axis' deadzone, until the joystick is unplugged.
+ */
+void
+hnd_set_joystick_deadzone
+(
+  unsigned int _index,
+  unsigned int _axis,
+  float        _deadzone
+);
+
+/**
+ * @brief Gets a file descriptor that becomes readable when any joystick has something
+ * to read, see hnd_add_wait_source.
+ *
+ * @return The file descriptor, or -1 if joysticks aren't available.
+ */
+int
+hnd_get_joystick_fd
+(
+  void
+);
+
+/* @note Bit tests, _button is below 32 */
+static inline int
+hnd_joystick_button_down
+(
+  const hnd_joystick_t *_joystick,
+  unsigned int          _button
+)
+{
+  return (int)((_joystick->buttons >> (_button & 31)) & 1);
+}
+
+static inline int
+hnd_joystick_button_pressed_this_frame
+(
+  const hnd_joystick_t *_joystick,
+  unsigned int          _button
+)
+{
+  return (int)((_joystick->pressed_buttons >> (_button & 31)) & 1);
+}
+
+static inline int
+hnd_joystick_button_released_this_frame
+(
+  const hnd_joystick_t *_joystick,
+  unsigned int          _button
+)
+{
+  return (int)((_joystick->released_buttons >> (_button & 31)) & 1);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_JOYSTICK_H__ */
@@ -32,6 +32,7 @@ extern "C"
 typedef struct hnd_linux_event_t
 {
   unsigned int type;
+  /* @note Only valid inside hnd_poll_events, freed before it returns */
   xcb_generic_event_t *xcb_event;
 
   struct
@@ -45,9 +46,9 @@ typedef struct hnd_linux_event_t
     unsigned int pressed_button;
     unsigned int released_button;
 
-    hnd_vector_t position;
-    hnd_vector_t pressed_position;
-    hnd_vector_t released_position;
+    hnd_vec2_t position;
+    hnd_vec2_t pressed_position;
+    hnd_vec2_t released_position;
   } mouse;
 } hnd_linux_event_t;
   
@@ -0,0 +1,497 @@
+/**
+ * @file src/core/event/linux_joystick.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "joystick.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <unistd.h>
+#include <linux/input.h>
+#include <sys/epoll.h>
+#include <sys/inotify.h>
+#include <sys/ioctl.h>
+
+#define HND_JOYSTICK_DIRECTORY "/dev/input"
+
+/* @note Events read per read() call */
+#define HND_JOYSTICK_READ_BATCH 64
+
+#define HND_BITS_PER_LONG (8 * sizeof(unsigned long))
+#define HND_TEST_BIT(_bits, _bit) (((_bits)[(_bit) / HND_BITS_PER_LONG] >> ((_bit) % HND_BITS_PER_LONG)) & 1)
+
+/**
+ * @brief Evdev side of a joystick.
+ */
+typedef struct hnd_joystick_device_t
+{
+  int fd;
+  /* @note Name inside HND_JOYSTICK_DIRECTORY, as inotify reports it */
+  char node[32];
+  /* @note The kernel dropped events, the state is read back on the next report */
+  int resync;
+
+  int32_t raw[HND_JOYSTICK_MAX_AXES];
+  float center[HND_JOYSTICK_MAX_AXES];
+  float scale[HND_JOYSTICK_MAX_AXES];
+  float deadzone[HND_JOYSTICK_MAX_AXES];
+} hnd_joystick_device_t;
+
+static hnd_joystick_t joysticks[HND_MAX_JOYSTICKS];
+static hnd_joystick_device_t devices[HND_MAX_JOYSTICKS];
+
+static int epoll_fd = -1;
+static int inotify_fd = -1;
+
+/* @note Evdev axis codes, by HND_JOYSTICK_AXIS_* */
+static const unsigned int axis_codes[HND_JOYSTICK_MAX_AXES] =
+{
+  ABS_X,
+  ABS_Y,
+  ABS_Z,
+  ABS_RX,
+  ABS_RY,
+  ABS_RZ,
+  ABS_HAT0X,
+  ABS_HAT0Y
+};
+
+/**
+ * @brief Gets the HND_JOYSTICK_AXIS_* of an evdev axis code.
+ *
+ * @return The axis, or -1 if it isn't one we track.
+ */
+static int
+hnd_get_joystick_axis
+(
+  unsigned int _code
+)
+{
+  switch (_code)
+  {
+  case ABS_X:
+  case ABS_Y:
+  case ABS_Z:
+  case ABS_RX:
+  case ABS_RY:
+  case ABS_RZ:
+    return (int)(_code - ABS_X);
+  case ABS_HAT0X:
+    return HND_JOYSTICK_AXIS_HAT_X;
+  case ABS_HAT0Y:
+    return HND_JOYSTICK_AXIS_HAT_Y;
+  default:
+    return -1;
+  }
+}
+
+/**
+ * @brief Reads the whole state back from the device, after dropped events.
+ */
+static void
+hnd_resync_joystick
+(
+  unsigned int _index
+)
+{
+  hnd_joystick_t *joystick = &joysticks[_index];
+  hnd_joystick_device_t *device = &devices[_index];
+
+  unsigned long key_bits[KEY_CNT / HND_BITS_PER_LONG + 1];
+  memset(key_bits, 0x00, sizeof(key_bits));
+  ioctl(device->fd, EVIOCGKEY(sizeof(key_bits)), key_bits);
+
+  uint32_t buttons = 0;
+  for (unsigned int i = 0; i < 32; ++i)
+    buttons |= (uint32_t)HND_TEST_BIT(key_bits, BTN_JOYSTICK + i) << i;
+
+  joystick->pressed_buttons |= buttons & ~joystick->buttons;
+  joystick->released_buttons |= joystick->buttons & ~buttons;
+  joystick->buttons = buttons;
+
+  for (int i = 0; i < HND_JOYSTICK_MAX_AXES; ++i)
+  {
+    struct input_absinfo info;
+    if (ioctl(device->fd, EVIOCGABS(axis_codes[i]), &info) == 0)
+      device->raw[i] = info.value;
+  }
+}
+
+/**
+ * @brief Opens a device node if it's a joystick and there's a free slot.
+ */
+static void
+hnd_open_joystick
+(
+  const char *_node
+)
+{
+  if (strncmp(_node, "event", 5) != 0 || strlen(_node) >= sizeof(devices[0].node))
+    return;
+
+  int index = -1;
+  for (int i = HND_MAX_JOYSTICKS - 1; i >= 0; --i)
+  {
+    if (joysticks[i].connected && strcmp(devices[i].node, _node) == 0)
+      return;
+    if (!joysticks[i].connected)
+      index = i;
+  }
+  if (index < 0)
+  {
+    hnd_print_debug(HND_WARNING, "Too many joysticks", HND_FAILURE);
+
+    return;
+  }
+
+  /* @note Fails until udev gives us access, IN_ATTRIB brings us back here */
+  char path[64];
+  snprintf(path, sizeof(path), HND_JOYSTICK_DIRECTORY "/%s", _node);
+  int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0)
+    return;
+
+  unsigned long key_bits[KEY_CNT / HND_BITS_PER_LONG + 1];
+  memset(key_bits, 0x00, sizeof(key_bits));
+  ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(key_bits)), key_bits);
+  if (!HND_TEST_BIT(key_bits, BTN_JOYSTICK) && !HND_TEST_BIT(key_bits, BTN_GAMEPAD))
+  {
+    close(fd);
+
+    return;
+  }
+
+  hnd_joystick_t *joystick = &joysticks[index];
+  hnd_joystick_device_t *device = &devices[index];
+  memset(joystick, 0x00, sizeof(hnd_joystick_t));
+  memset(device, 0x00, sizeof(hnd_joystick_device_t));
+
+  device->fd = fd;
+  strcpy(device->node, _node);
+  ioctl(fd, EVIOCGNAME(sizeof(joystick->name) - 1), joystick->name);
+
+  for (int i = 0; i < HND_JOYSTICK_MAX_AXES; ++i)
+  {
+    /* @note Missing axes keep a zero scale, and stay at 0 */
+    struct input_absinfo info;
+    if (ioctl(fd, EVIOCGABS(axis_codes[i]), &info) != 0 || info.maximum <= info.minimum)
+      continue;
+
+    /* @note Decided by the axis' role, not its range. Plenty of pads report their sticks as
+     * 0 to 255, those still rest in the middle.
+     */
+    float range = (float)info.maximum - (float)info.minimum;
+    if (i == HND_JOYSTICK_AXIS_LEFT_TRIGGER || i == HND_JOYSTICK_AXIS_RIGHT_TRIGGER)
+    {
+      /* @note Triggers rest at their minimum */
+      device->center[i] = (float)info.minimum;
+      device->scale[i] = 1.0f / range;
+    }
+    else
+    {
+      device->center[i] = ((float)info.minimum + (float)info.maximum) * 0.5f;
+      device->scale[i] = 2.0f / range;
+    }
+
+    device->deadzone[i] = info.flat > 0 ? fminf((float)info.flat * device->scale[i], 0.9f) : HND_JOYSTICK_DEFAULT_DEADZONE;
+  }
+
+  struct epoll_event event = { .events = EPOLLIN, .data.u32 = (uint32_t)index };
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+  joystick->connected = HND_OK;
+  hnd_resync_joystick((unsigned int)index);
+  joystick->pressed_buttons = 0;
+
+  hnd_print_debug(HND_LOG, "Connected joystick", joystick->name);
+}
+
+static void
+hnd_close_joystick
+(
+  unsigned int _index
+)
+{
+  hnd_joystick_t *joystick = &joysticks[_index];
+  hnd_joystick_device_t *device = &devices[_index];
+
+  epoll_ctl(epoll_fd, EPOLL_CTL_DEL, device->fd, NULL);
+  close(device->fd);
+  device->fd = -1;
+
+  /* @note Held buttons count as released */
+  joystick->released_buttons |= joystick->buttons;
+  joystick->buttons = 0;
+  memset(joystick->axes, 0x00, sizeof(joystick->axes));
+  joystick->connected = HND_NK;
+
+  hnd_print_debug(HND_LOG, "Disconnected joystick", joystick->name);
+}
+
+/**
+ * @brief Reads every pending event of a joystick.
+ */
+static void
+hnd_read_joystick
+(
+  unsigned int _index
+)
+{
+  hnd_joystick_t *joystick = &joysticks[_index];
+  hnd_joystick_device_t *device = &devices[_index];
+
+  struct input_event events[HND_JOYSTICK_READ_BATCH];
+  for (;;)
+  {
+    ssize_t size = read(device->fd, events, sizeof(events));
+    if (size < 0)
+    {
+      /* @note ENODEV once unplugged */
+      if (errno != EAGAIN && errno != EINTR)
+        hnd_close_joystick(_index);
+
+      return;
+    }
+
+    size_t count = (size_t)size / sizeof(struct input_event);
+    for (size_t i = 0; i < count; ++i)
+    {
+      const struct input_event *event = &events[i];
+
+      if (event->type == EV_SYN)
+      {
+        if (event->code == SYN_DROPPED)
+          device->resync = HND_OK;
+        else if (event->code == SYN_REPORT && device->resync)
+        {
+          hnd_resync_joystick(_index);
+          device->resync = HND_NK;
+        }
+
+        continue;
+      }
+
+      /* @note Everything up to the next report is incomplete */
+      if (device->resync)
+        continue;
+
+      if (event->type == EV_KEY && event->code >= BTN_JOYSTICK && event->code < BTN_JOYSTICK + 32)
+      {
+        uint32_t bit = (uint32_t)1 << (event->code - BTN_JOYSTICK);
+        if (event->value == 1)
+        {
+          joystick->buttons |= bit;
+          joystick->pressed_buttons |= bit;
+        }
+        else if (event->value == 0)
+        {
+          joystick->buttons &= ~bit;
+          joystick->released_buttons |= bit;
+        }
+      }
+      else if (event->type == EV_ABS)
+      {
+        int axis = hnd_get_joystick_axis(event->code);
+        if (axis >= 0)
+          device->raw[axis] = event->value;
+      }
+    }
+
+    if ((size_t)size < sizeof(events))
+      return;
+  }
+}
+
+/**
+ * @brief Opens and closes joysticks as their nodes come and go.
+ */
+static void
+hnd_handle_joystick_plugging
+(
+  void
+)
+{
+  char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+  for (;;)
+  {
+    ssize_t size = read(inotify_fd, buffer, sizeof(buffer));
+    if (size <= 0)
+      return;
+
+    for (char *position = buffer; position < buffer + size;)
+    {
+      struct inotify_event *event = (struct inotify_event *)position;
+      position += sizeof(struct inotify_event) + event->len;
+
+      if (!event->len)
+        continue;
+
+      if (event->mask & (IN_CREATE | IN_ATTRIB))
+        hnd_open_joystick(event->name);
+      else if (event->mask & IN_DELETE)
+      {
+        for (unsigned int i = 0; i < HND_MAX_JOYSTICKS; ++i)
+        {
+          if (joysticks[i].connected && strcmp(devices[i].node, event->name) == 0)
+            hnd_close_joystick(i);
+        }
+      }
+    }
+  }
+}
+
+int
+hnd_init_joysticks
+(
+  void
+)
+{
+  if (epoll_fd >= 0)
+    return HND_OK;
+
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (!hnd_assert(epoll_fd >= 0, "Could not create the joystick epoll set"))
+    return HND_NK;
+
+  /* @note Without inotify joysticks still work, just without plugging */
+  inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd >= 0)
+  {
+    if (inotify_add_watch(inotify_fd, HND_JOYSTICK_DIRECTORY, IN_CREATE | IN_ATTRIB | IN_DELETE) >= 0)
+    {
+      struct epoll_event event = { .events = EPOLLIN, .data.u32 = HND_MAX_JOYSTICKS };
+      epoll_ctl(epoll_fd, EPOLL_CTL_ADD, inotify_fd, &event);
+    }
+    else
+    {
+      close(inotify_fd);
+      inotify_fd = -1;
+    }
+  }
+
+  DIR *directory = opendir(HND_JOYSTICK_DIRECTORY);
+  if (!directory)
+  {
+    hnd_print_debug(HND_WARNING, "Could not open " HND_JOYSTICK_DIRECTORY, HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  struct dirent *entry;
+  while ((entry = readdir(directory)))
+    hnd_open_joystick(entry->d_name);
+  closedir(directory);
+
+  return HND_OK;
+}
+
+void
+hnd_end_joysticks
+(
+  void
+)
+{
+  if (epoll_fd < 0)
+    return;
+
+  for (unsigned int i = 0; i < HND_MAX_JOYSTICKS; ++i)
+  {
+    if (joysticks[i].connected)
+      hnd_close_joystick(i);
+  }
+
+  if (inotify_fd >= 0)
+    close(inotify_fd);
+  close(epoll_fd);
+
+  inotify_fd = -1;
+  epoll_fd = -1;
+}
+
+void
+hnd_poll_joysticks
+(
+  void
+)
+{
+  if (epoll_fd < 0)
+    return;
+
+  for (unsigned int i = 0; i < HND_MAX_JOYSTICKS; ++i)
+  {
+    joysticks[i].pressed_buttons = 0;
+    joysticks[i].released_buttons = 0;
+  }
+
+  if (inotify_fd >= 0)
+    hnd_handle_joystick_plugging();
+
+  for (unsigned int i = 0; i < HND_MAX_JOYSTICKS; ++i)
+  {
+    if (!joysticks[i].connected)
+      continue;
+
+    hnd_read_joystick(i);
+    if (!joysticks[i].connected)
+      continue;
+
+    hnd_joystick_device_t *device = &devices[i];
+    hnd_normalize_joystick_axes(device->raw,
+                                device->center,
+                                device->scale,
+                                device->deadzone,
+                                joysticks[i].axes,
+                                HND_JOYSTICK_MAX_AXES);
+  }
+}
+
+const hnd_joystick_t *
+hnd_get_joystick
+(
+  unsigned int _index
+)
+{
+  if (_index >= HND_MAX_JOYSTICKS)
+    return NULL;
+
+  return &joysticks[_index];
+}
+
+void
+hnd_set_joystick_deadzone
+(
+  unsigned int _index,
+  unsigned int _axis,
+  float        _deadzone
+)
+{
+  if (!hnd_assert(_index < HND_MAX_JOYSTICKS && _axis < HND_JOYSTICK_MAX_AXES, HND_SYNTAX))
+    return;
+
+  devices[_index].deadzone[_axis] = fminf(fmaxf(_deadzone, 0.0f), 0.9f);
+}
+
+int
+hnd_get_joystick_fd
+(
+  void
+)
+{
+  return epoll_fd;
+}
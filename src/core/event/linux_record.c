@@ -0,0 +1,92 @@
+/**
+ * @file src/core/event/linux_record.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "record.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+int
+hnd_open_replay
+(
+  hnd_replay_t *_replay,
+  const char   *_path
+)
+{
+  if (!hnd_assert(_replay != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_path != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  memset(_replay, 0x00, sizeof(hnd_replay_t));
+
+  int fd = open(_path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    hnd_print_debug(HND_WARNING, "Could not open the recording", _path);
+
+    return HND_NK;
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size < (off_t)sizeof(hnd_recording_header_t))
+  {
+    close(fd);
+    hnd_print_debug(HND_WARNING, "Not a recording", _path);
+
+    return HND_NK;
+  }
+
+  /* @note The mapping outlives the descriptor. Replays read front to back. */
+  void *mapping = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+  {
+    hnd_print_debug(HND_WARNING, "Could not map the recording", _path);
+
+    return HND_NK;
+  }
+  madvise(mapping, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+
+  _replay->mapping = mapping;
+  _replay->mapping_size = (size_t)file_stat.st_size;
+  if (!hnd_read_replay_header(_replay))
+  {
+    hnd_close_replay(_replay);
+
+    return HND_NK;
+  }
+
+  return HND_OK;
+}
+
+void
+hnd_close_replay
+(
+  hnd_replay_t *_replay
+)
+{
+  if (!hnd_assert(_replay != NULL, HND_SYNTAX))
+    return;
+
+  if (_replay->mapping)
+    munmap(_replay->mapping, _replay->mapping_size);
+
+  memset(_replay, 0x00, sizeof(hnd_replay_t));
+}
@@ -0,0 +1,211 @@
+/**
+ * @file src/core/event/record.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Input recording and replay. A recording holds every event handed out by
+ * hnd_poll_event_batch along with the frame it was handed out on, so a play session
+ * can be fed back frame by frame for reproducible benchmarks.
+ */
+
+#ifndef __HND_RECORD_H__
+#define __HND_RECORD_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "event.h"
+#include <stdio.h>
+
+/* @note "HNDR", read as a little endian uint32_t */
+#define HND_RECORDING_MAGIC   0x52444e48
+#define HND_RECORDING_VERSION 1
+
+/**
+ * @brief Recording file header, followed by count hnd_input_record_t.
+ *
+ * @note Written in the machine's byte order, recordings aren't meant to be moved
+ * between architectures.
+ */
+typedef struct hnd_recording_header_t
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t reserved;
+  uint64_t count;
+  uint64_t frames;
+} hnd_recording_header_t;
+
+/**
+ * @brief A recorded event, 32 bytes. The event keeps its original timestamps.
+ */
+typedef struct hnd_input_record_t
+{
+  uint64_t frame;
+  hnd_input_event_t event;
+} hnd_input_record_t;
+
+typedef struct hnd_recorder_t
+{
+  FILE *file;
+  uint64_t frame;
+  uint64_t count;
+} hnd_recorder_t;
+
+/**
+ * @brief A recording mapped into memory, records point straight into the mapping.
+ */
+typedef struct hnd_replay_t
+{
+  const hnd_input_record_t *records;
+  uint64_t count;
+  uint64_t frames;
+
+  /* @note Next record to hand out, and the frame being replayed */
+  uint64_t next;
+  uint64_t frame;
+
+  void *mapping;
+  size_t mapping_size;
+  /* @note Platform handles, unused on linux */
+  void *file_handle;
+  void *mapping_handle;
+} hnd_replay_t;
+
+/**
+ * @brief Creates a recording file.
+ *
+ * @param _recorder Specifies the recorder.
+ * @param _path     Specifies the file to write, replaced if it exists.
+ *
+ * @return The function state. HND_OK or HND_NK.
+ */
+int
+hnd_start_recording
+(
+  hnd_recorder_t *_recorder,
+  const char     *_path
+);
+
+/**
+ * @brief Appends events to the current frame.
+ */
+void
+hnd_record_events
+(
+  hnd_recorder_t          *_recorder,
+  const hnd_input_event_t *_events,
+  size_t                   _count
+);
+
+/**
+ * @brief Moves on to the next frame. Frames without events take no space.
+ */
+void
+hnd_end_recorder_frame
+(
+  hnd_recorder_t *_recorder
+);
+
+/**
+ * @brief Writes the final header and closes the file.
+ */
+void
+hnd_stop_recording
+(
+  hnd_recorder_t *_recorder
+);
+
+/**
+ * @brief Maps a recording for replay.
+ *
+ * @param _replay Specifies the replay.
+ * @param _path   Specifies the recording.
+ *
+ * @return HND_NK if the file can't be mapped or isn't a recording.
+ */
+int
+hnd_open_replay
+(
+  hnd_replay_t *_replay,
+  const char   *_path
+);
+
+void
+hnd_close_replay
+(
+  hnd_replay_t *_replay
+);
+
+/**
+ * @brief Validates the mapped header and points records at the data.
+ *
+ * @note Shared by the platform's hnd_open_replay, not meant to be called directly.
+ */
+int
+hnd_read_replay_header
+(
+  hnd_replay_t *_replay
+);
+
+/**
+ * @brief Gets the records of the current frame, without copying, and moves on to the
+ * next one.
+ *
+ * @param _replay  Specifies the replay.
+ * @param _records Returns a pointer into the mapping, valid until hnd_close_replay.
+ *
+ * @return The number of records, 0 for frames without events.
+ */
+size_t
+hnd_next_replay_frame
+(
+  hnd_replay_t              *_replay,
+  const hnd_input_record_t **_records
+);
+
+/**
+ * @brief Copies the current frame's events out, the replay side of hnd_poll_event_batch.
+ *
+ * @note Moves on to the next frame once the current one is all handed out, so a frame
+ * larger than _capacity takes several calls.
+ *
+ * @return The number of events copied.
+ */
+size_t
+hnd_poll_replay_batch
+(
+  hnd_replay_t      *_replay,
+  hnd_input_event_t *_events,
+  size_t             _capacity
+);
+
+/**
+ * @brief Checks whether every recorded frame was replayed.
+ */
+int
+hnd_is_replay_done
+(
+  const hnd_replay_t *_replay
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_RECORD_H__ */
@@ -48,9 +48,9 @@ typedef struct hnd_win32_event_t
     unsigned int pressed_button;
     unsigned int released_button;
 
-    hnd_vector position;
-    hnd_vector pressed_position;
-    hnd_vector released_position;
+    hnd_vec2_t position;
+    hnd_vec2_t pressed_position;
+    hnd_vec2_t released_position;
   } mouse;
 } hnd_win32_event_t;
 
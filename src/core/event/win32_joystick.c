@@ -0,0 +1,84 @@
+/**
+ * @file src/core/event/win32_joystick.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Joysticks aren't supported on win32 yet, no joystick ever connects.
+ */
+
+#include "joystick.h"
+
+static hnd_joystick_t joysticks[HND_MAX_JOYSTICKS];
+
+int
+hnd_init_joysticks
+(
+  void
+)
+{
+  hnd_print_debug(HND_WARNING, "Joysticks aren't supported on win32", HND_FAILURE);
+
+  return HND_NK;
+}
+
+void
+hnd_end_joysticks
+(
+  void
+)
+{
+}
+
+void
+hnd_poll_joysticks
+(
+  void
+)
+{
+}
+
+const hnd_joystick_t *
+hnd_get_joystick
+(
+  unsigned int _index
+)
+{
+  if (_index >= HND_MAX_JOYSTICKS)
+    return NULL;
+
+  return &joysticks[_index];
+}
+
+void
+hnd_set_joystick_deadzone
+(
+  unsigned int _index,
+  unsigned int _axis,
+  float        _deadzone
+)
+{
+  (void)_index;
+  (void)_axis;
+  (void)_deadzone;
+}
+
+int
+hnd_get_joystick_fd
+(
+  void
+)
+{
+  return -1;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file src/core/event/win32_record.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "record.h"
+#include <windows.h>
+
+int
+hnd_open_replay
+(
+  hnd_replay_t *_replay,
+  const char   *_path
+)
+{
+  if (!hnd_assert(_replay != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_path != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  memset(_replay, 0x00, sizeof(hnd_replay_t));
+
+  HANDLE file = CreateFileA(_path,
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    hnd_print_debug(HND_WARNING, "Could not open the recording", _path);
+
+    return HND_NK;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(hnd_recording_header_t))
+  {
+    CloseHandle(file);
+    hnd_print_debug(HND_WARNING, "Not a recording", _path);
+
+    return HND_NK;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+  if (!view)
+  {
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    hnd_print_debug(HND_WARNING, "Could not map the recording", _path);
+
+    return HND_NK;
+  }
+
+  _replay->mapping = view;
+  _replay->mapping_size = (size_t)size.QuadPart;
+  _replay->file_handle = file;
+  _replay->mapping_handle = mapping;
+  if (!hnd_read_replay_header(_replay))
+  {
+    hnd_close_replay(_replay);
+
+    return HND_NK;
+  }
+
+  return HND_OK;
+}
+
+void
+hnd_close_replay
+(
+  hnd_replay_t *_replay
+)
+{
+  if (!hnd_assert(_replay != NULL, HND_SYNTAX))
+    return;
+
+  if (_replay->mapping)
+    UnmapViewOfFile(_replay->mapping);
+  if (_replay->mapping_handle)
+    CloseHandle(_replay->mapping_handle);
+  if (_replay->file_handle)
+    CloseHandle(_replay->file_handle);
+
+  memset(_replay, 0x00, sizeof(hnd_replay_t));
+}
@@ -0,0 +1,509 @@
+/**
+ * @file src/core/memory/common_memory.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "memory.h"
+
+#define HND_ALIGN_UP(_value, _alignment) (((_value) + ((_alignment) - 1)) & ~((size_t)(_alignment) - 1))
+
+/* @note Keeps the first allocation of a block aligned */
+#define HND_ARENA_HEADER_SIZE HND_ALIGN_UP(sizeof(hnd_arena_block_t), HND_MEMORY_ALIGNMENT)
+
+static const char *tag_names[HND_MEMORY_TAG_COUNT] =
+{
+  "general",
+  "window",
+  "renderer",
+  "event",
+  "math",
+  "asset"
+};
+
+/* @note Updated atomically, allocations can happen on any thread */
+static hnd_memory_stats_t stats;
+
+/**
+ * @brief Raises a peak counter to _value, if it's higher.
+ */
+static void
+hnd_update_peak
+(
+  size_t *_peak,
+  size_t  _value
+)
+{
+  size_t peak = __atomic_load_n(_peak, __ATOMIC_RELAXED);
+  while (_value > peak &&
+         !__atomic_compare_exchange_n(_peak, &peak, _value, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+}
+
+void
+hnd_record_allocation
+(
+  unsigned int _tag,
+  size_t       _size
+)
+{
+  hnd_memory_tag_stats_t *tag = &stats.tags[_tag];
+
+  size_t live = __atomic_add_fetch(&tag->live_bytes, _size, __ATOMIC_RELAXED);
+  hnd_update_peak(&tag->peak_bytes, live);
+  __atomic_add_fetch(&tag->live_allocations, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&tag->total_allocations, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&tag->frame_allocations, 1, __ATOMIC_RELAXED);
+
+  live = __atomic_add_fetch(&stats.live_bytes, _size, __ATOMIC_RELAXED);
+  hnd_update_peak(&stats.peak_bytes, live);
+  __atomic_add_fetch(&stats.frame_allocations, 1, __ATOMIC_RELAXED);
+}
+
+void
+hnd_record_free
+(
+  unsigned int _tag,
+  size_t       _size
+)
+{
+  hnd_memory_tag_stats_t *tag = &stats.tags[_tag];
+
+  __atomic_sub_fetch(&tag->live_bytes, _size, __ATOMIC_RELAXED);
+  __atomic_sub_fetch(&tag->live_allocations, 1, __ATOMIC_RELAXED);
+  __atomic_sub_fetch(&stats.live_bytes, _size, __ATOMIC_RELAXED);
+}
+
+void
+hnd_end_memory_frame
+(
+  void
+)
+{
+  for (int i = 0; i < HND_MEMORY_TAG_COUNT; ++i)
+  {
+    size_t count = __atomic_exchange_n(&stats.tags[i].frame_allocations, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats.tags[i].last_frame_allocations, count, __ATOMIC_RELAXED);
+  }
+
+  size_t count = __atomic_exchange_n(&stats.frame_allocations, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&stats.last_frame_allocations, count, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&stats.frame, 1, __ATOMIC_RELAXED);
+}
+
+void
+hnd_get_memory_stats
+(
+  hnd_memory_stats_t *_stats
+)
+{
+  if (!hnd_assert(_stats != NULL, HND_SYNTAX))
+    return;
+
+  /* @note Counters are read one by one, so the snapshot can be slightly torn while other
+   * threads allocate. Good enough for telemetry.
+   */
+  for (int i = 0; i < HND_MEMORY_TAG_COUNT; ++i)
+  {
+    hnd_memory_tag_stats_t *source = &stats.tags[i];
+    hnd_memory_tag_stats_t *destination = &_stats->tags[i];
+
+    destination->live_bytes = __atomic_load_n(&source->live_bytes, __ATOMIC_RELAXED);
+    destination->peak_bytes = __atomic_load_n(&source->peak_bytes, __ATOMIC_RELAXED);
+    destination->live_allocations = __atomic_load_n(&source->live_allocations, __ATOMIC_RELAXED);
+    destination->total_allocations = __atomic_load_n(&source->total_allocations, __ATOMIC_RELAXED);
+    destination->frame_allocations = __atomic_load_n(&source->frame_allocations, __ATOMIC_RELAXED);
+    destination->last_frame_allocations = __atomic_load_n(&source->last_frame_allocations, __ATOMIC_RELAXED);
+  }
+
+  _stats->live_bytes = __atomic_load_n(&stats.live_bytes, __ATOMIC_RELAXED);
+  _stats->peak_bytes = __atomic_load_n(&stats.peak_bytes, __ATOMIC_RELAXED);
+  _stats->frame_allocations = __atomic_load_n(&stats.frame_allocations, __ATOMIC_RELAXED);
+  _stats->last_frame_allocations = __atomic_load_n(&stats.last_frame_allocations, __ATOMIC_RELAXED);
+  _stats->frame = __atomic_load_n(&stats.frame, __ATOMIC_RELAXED);
+}
+
+void
+hnd_print_memory_stats
+(
+  void
+)
+{
+  hnd_memory_stats_t snapshot;
+  hnd_get_memory_stats(&snapshot);
+
+  printf("%-10s %12s %12s %8s %10s %8s\n", "tag", "live", "peak", "allocs", "total", "frame");
+  for (int i = 0; i < HND_MEMORY_TAG_COUNT; ++i)
+  {
+    hnd_memory_tag_stats_t *tag = &snapshot.tags[i];
+    printf("%-10s %12zu %12zu %8zu %10zu %8zu\n",
+           tag_names[i],
+           tag->live_bytes,
+           tag->peak_bytes,
+           tag->live_allocations,
+           tag->total_allocations,
+           tag->last_frame_allocations);
+  }
+
+  printf("%-10s %12zu %12zu %8s %10s %8zu\n",
+         "all",
+         snapshot.live_bytes,
+         snapshot.peak_bytes,
+         "",
+         "",
+         snapshot.last_frame_allocations);
+}
+
+size_t
+hnd_report_memory_leaks
+(
+  void
+)
+{
+  hnd_memory_stats_t snapshot;
+  hnd_get_memory_stats(&snapshot);
+
+  size_t leaks = 0;
+  for (int i = 0; i < HND_MEMORY_TAG_COUNT; ++i)
+  {
+    hnd_memory_tag_stats_t *tag = &snapshot.tags[i];
+    if (!tag->live_allocations)
+      continue;
+
+    char message[128];
+    snprintf(message, sizeof(message), "%zu %s allocations, %zu bytes, still live", tag->live_allocations, tag_names[i], tag->live_bytes);
+    hnd_print_debug(HND_WARNING, message, "Memory leak");
+
+    leaks += tag->live_allocations;
+  }
+
+  return leaks;
+}
+
+#ifdef HND_DEBUG
+static void
+hnd_report_memory_leaks_at_exit
+(
+  void
+)
+{
+  hnd_report_memory_leaks();
+}
+
+__attribute__((constructor)) static void
+hnd_init_memory_report
+(
+  void
+)
+{
+  atexit(hnd_report_memory_leaks_at_exit);
+}
+#endif /* HND_DEBUG */
+
+void
+hnd_init_arena
+(
+  hnd_arena_t  *_arena,
+  size_t        _block_size,
+  unsigned int  _flags,
+  unsigned int  _tag
+)
+{
+  if (!hnd_assert(_arena != NULL, HND_SYNTAX))
+    return;
+  if (!hnd_assert(_tag < HND_MEMORY_TAG_COUNT, HND_SYNTAX))
+    return;
+
+  _arena->first = NULL;
+  _arena->current = NULL;
+  _arena->block_size = _block_size ? _block_size : HND_ARENA_DEFAULT_BLOCK_SIZE;
+  _arena->flags = _flags;
+  _arena->tag = _tag;
+  _arena->last_allocation = NULL;
+}
+
+void
+hnd_end_arena
+(
+  hnd_arena_t *_arena
+)
+{
+  if (!hnd_assert(_arena != NULL, HND_SYNTAX))
+    return;
+
+  hnd_arena_block_t *block = _arena->first;
+  while (block)
+  {
+    hnd_arena_block_t *next = block->next;
+    hnd_record_free(_arena->tag, block->size);
+    hnd_unmap_memory(block, block->size);
+
+    block = next;
+  }
+
+  _arena->first = NULL;
+  _arena->current = NULL;
+  _arena->last_allocation = NULL;
+}
+
+/**
+ * @brief Gets an arena block with room for an allocation, reusing blocks left by a reset.
+ *
+ * @param _arena Specifies the arena.
+ * @param _size  Specifies the allocation size, including worst case alignment padding.
+ *
+ * @return The block, now the arena's current one, or NULL.
+ */
+static hnd_arena_block_t *
+hnd_get_arena_block
+(
+  hnd_arena_t *_arena,
+  size_t       _size
+)
+{
+  hnd_arena_block_t *previous = _arena->current;
+
+  /* @note Blocks after the current one are leftovers from before a reset */
+  for (hnd_arena_block_t *block = previous ? previous->next : _arena->first; block; block = block->next)
+  {
+    block->used = HND_ARENA_HEADER_SIZE;
+    if (block->size - block->used >= _size)
+    {
+      _arena->current = block;
+
+      return block;
+    }
+
+    previous = block;
+  }
+
+  size_t size = HND_ARENA_HEADER_SIZE + _size;
+  if (size < _arena->block_size)
+    size = _arena->block_size;
+
+  hnd_arena_block_t *block = hnd_map_memory(&size, _arena->flags);
+  if (!block)
+    return NULL;
+  hnd_record_allocation(_arena->tag, size);
+
+  block->next = NULL;
+  block->size = size;
+  block->used = HND_ARENA_HEADER_SIZE;
+
+  if (previous)
+    previous->next = block;
+  else
+    _arena->first = block;
+  _arena->current = block;
+
+  return block;
+}
+
+void *
+hnd_push_arena
+(
+  hnd_arena_t *_arena,
+  size_t       _size,
+  size_t       _alignment
+)
+{
+  if (!_alignment)
+    _alignment = HND_MEMORY_ALIGNMENT;
+
+  hnd_arena_block_t *block = _arena->current;
+  size_t offset = 0;
+
+  if (block)
+  {
+    offset = HND_ALIGN_UP((uintptr_t)block + block->used, _alignment) - (uintptr_t)block;
+    if (offset + _size > block->size)
+      block = NULL;
+  }
+
+  if (!block)
+  {
+    block = hnd_get_arena_block(_arena, _size + _alignment);
+    if (!block)
+      return NULL;
+
+    offset = HND_ALIGN_UP((uintptr_t)block + block->used, _alignment) - (uintptr_t)block;
+  }
+
+  block->used = offset + _size;
+  _arena->last_allocation = (char *)block + offset;
+
+  return _arena->last_allocation;
+}
+
+void
+hnd_reset_arena
+(
+  hnd_arena_t *_arena
+)
+{
+  /* @note Later blocks are reset lazily, when hnd_get_arena_block reaches them */
+  _arena->current = _arena->first;
+  if (_arena->current)
+    _arena->current->used = HND_ARENA_HEADER_SIZE;
+
+  _arena->last_allocation = NULL;
+}
+
+static void *
+hnd_reallocate_arena
+(
+  void   *_data,
+  void   *_memory,
+  size_t  _old_size,
+  size_t  _new_size
+)
+{
+  hnd_arena_t *arena = _data;
+  hnd_arena_block_t *block = arena->current;
+  int newest = _memory && _memory == arena->last_allocation;
+
+  if (_new_size == 0)
+  {
+    if (newest)
+    {
+      block->used = (size_t)((char *)_memory - (char *)block);
+      arena->last_allocation = NULL;
+    }
+
+    return NULL;
+  }
+
+  /* @note The newest allocation can grow or shrink in place */
+  if (newest && (size_t)((char *)_memory - (char *)block) + _new_size <= block->size)
+  {
+    block->used = (size_t)((char *)_memory - (char *)block) + _new_size;
+
+    return _memory;
+  }
+
+  void *new_memory = hnd_push_arena(arena, _new_size, 0);
+  if (new_memory && _memory)
+    memcpy(new_memory, _memory, _old_size < _new_size ? _old_size : _new_size);
+
+  return new_memory;
+}
+
+hnd_allocator_t
+hnd_get_arena_allocator
+(
+  hnd_arena_t *_arena
+)
+{
+  return (hnd_allocator_t){ hnd_reallocate_arena, _arena };
+}
+
+/**
+ * @brief Heap allocation function, _data holds the tag.
+ */
+static void *
+hnd_reallocate_heap
+(
+  void   *_data,
+  void   *_memory,
+  size_t  _old_size,
+  size_t  _new_size
+)
+{
+  unsigned int tag = (unsigned int)(uintptr_t)_data;
+
+  if (_new_size == 0)
+  {
+    if (_memory)
+      hnd_record_free(tag, _old_size);
+    free(_memory);
+
+    return NULL;
+  }
+
+  void *new_memory = realloc(_memory, _new_size);
+  if (!new_memory)
+    return NULL;
+
+  if (_memory)
+    hnd_record_free(tag, _old_size);
+  hnd_record_allocation(tag, _new_size);
+
+  return new_memory;
+}
+
+hnd_allocator_t
+hnd_get_tagged_allocator
+(
+  unsigned int _tag
+)
+{
+  hnd_assert(_tag < HND_MEMORY_TAG_COUNT, HND_SYNTAX);
+
+  return (hnd_allocator_t){ hnd_reallocate_heap, (void *)(uintptr_t)_tag };
+}
+
+hnd_allocator_t
+hnd_get_heap_allocator
+(
+  void
+)
+{
+  return hnd_get_tagged_allocator(HND_MEMORY_TAG_GENERAL);
+}
+
+void *
+hnd_allocate
+(
+  hnd_allocator_t *_allocator,
+  size_t           _size
+)
+{
+  if (!_allocator)
+    return hnd_reallocate_heap((void *)HND_MEMORY_TAG_GENERAL, NULL, 0, _size);
+
+  return _allocator->reallocate(_allocator->data, NULL, 0, _size);
+}
+
+void *
+hnd_reallocate
+(
+  hnd_allocator_t *_allocator,
+  void            *_memory,
+  size_t           _old_size,
+  size_t           _new_size
+)
+{
+  if (!_allocator)
+    return hnd_reallocate_heap((void *)HND_MEMORY_TAG_GENERAL, _memory, _old_size, _new_size);
+
+  return _allocator->reallocate(_allocator->data, _memory, _old_size, _new_size);
+}
+
+void
+hnd_deallocate
+(
+  hnd_allocator_t *_allocator,
+  void            *_memory,
+  size_t           _size
+)
+{
+  if (!_memory)
+    return;
+
+  if (!_allocator)
+    hnd_reallocate_heap((void *)HND_MEMORY_TAG_GENERAL, _memory, _size, 0);
+  else
+    _allocator->reallocate(_allocator->data, _memory, _size, 0);
+}
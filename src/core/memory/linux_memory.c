@@ -0,0 +1,89 @@
+/**
+ * @file src/core/memory/linux_memory.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "memory.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+size_t
+hnd_get_page_size
+(
+  void
+)
+{
+  static size_t page_size = 0;
+  if (!page_size)
+    page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+  return page_size;
+}
+
+void *
+hnd_map_memory
+(
+  size_t       *_size,
+  unsigned int  _flags
+)
+{
+  if (!hnd_assert(_size != NULL, HND_SYNTAX))
+    return NULL;
+
+  void *memory = MAP_FAILED;
+
+  if (_flags & HND_MEMORY_HUGE_PAGES)
+  {
+    *_size = (*_size + HND_HUGE_PAGE_SIZE - 1) & ~((size_t)HND_HUGE_PAGE_SIZE - 1);
+
+#ifdef MAP_HUGETLB
+    /* @note Fails unless huge pages were reserved, e.g. through /proc/sys/vm/nr_hugepages */
+    memory = mmap(NULL, *_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED)
+      return memory;
+#endif /* MAP_HUGETLB */
+  }
+  else
+  {
+    size_t page_size = hnd_get_page_size();
+    *_size = (*_size + page_size - 1) & ~(page_size - 1);
+  }
+
+  memory = mmap(NULL, *_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (!hnd_assert(memory != MAP_FAILED, NULL))
+    return NULL;
+
+#ifdef MADV_HUGEPAGE
+  /* @note Asks for transparent huge pages instead, ignored when they're disabled */
+  if (_flags & HND_MEMORY_HUGE_PAGES)
+    madvise(memory, *_size, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+
+  return memory;
+}
+
+void
+hnd_unmap_memory
+(
+  void   *_memory,
+  size_t  _size
+)
+{
+  if (!_memory)
+    return;
+
+  munmap(_memory, _size);
+}
@@ -0,0 +1,341 @@
+/**
+ * @file src/core/memory/memory.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Allocators for engine objects. Subsystems take an hnd_allocator_t, NULL meaning the
+ * heap, so callers decide where memory comes from: the heap, a long lived arena, or the
+ * renderer's frame arena, which is reset on every buffer swap.
+ *
+ * @note Heap and mapped memory is accounted per tag, see hnd_get_memory_stats. Memory
+ * handed out by arenas and pools isn't, only the blocks backing them are.
+ */
+
+#ifndef __HND_MEMORY_H__
+#define __HND_MEMORY_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../../core/debug.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* @note Alignment of every allocation, enough for SSE loads */
+#define HND_MEMORY_ALIGNMENT 16
+
+/* @note Mapping flags */
+#define HND_MEMORY_HUGE_PAGES 0x1
+
+#define HND_HUGE_PAGE_SIZE         (2 * 1024 * 1024)
+#define HND_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/* @note Allocation tags, one per subsystem */
+#define HND_MEMORY_TAG_GENERAL  0
+#define HND_MEMORY_TAG_WINDOW   1
+#define HND_MEMORY_TAG_RENDERER 2
+#define HND_MEMORY_TAG_EVENT    3
+#define HND_MEMORY_TAG_MATH     4
+#define HND_MEMORY_TAG_ASSET    5
+#define HND_MEMORY_TAG_COUNT    6
+
+/**
+ * @brief Allocation function, modeled after realloc.
+ *
+ * @note _memory NULL allocates, _new_size 0 frees, anything else resizes. Sizes are always
+ * passed, so allocators don't need to store them.
+ */
+typedef void *(*hnd_reallocate_function_t)(void *_data, void *_memory, size_t _old_size, size_t _new_size);
+
+typedef struct hnd_allocator_t
+{
+  hnd_reallocate_function_t reallocate;
+  void *data;
+} hnd_allocator_t;
+
+/**
+ * @brief Memory usage of a single tag.
+ *
+ * @note Allocation counters count system allocations, reallocations included.
+ */
+typedef struct hnd_memory_tag_stats_t
+{
+  size_t live_bytes;
+  size_t peak_bytes;
+  size_t live_allocations;
+  size_t total_allocations;
+
+  size_t frame_allocations;
+  size_t last_frame_allocations;
+} hnd_memory_tag_stats_t;
+
+typedef struct hnd_memory_stats_t
+{
+  hnd_memory_tag_stats_t tags[HND_MEMORY_TAG_COUNT];
+
+  size_t live_bytes;
+  size_t peak_bytes;
+  size_t frame_allocations;
+  size_t last_frame_allocations;
+  uint64_t frame;
+} hnd_memory_stats_t;
+
+/**
+ * @brief Header at the start of every arena block.
+ */
+typedef struct hnd_arena_block_t
+{
+  struct hnd_arena_block_t *next;
+  size_t size;
+  size_t used;
+} hnd_arena_block_t;
+
+/**
+ * @brief Growable bump allocator.
+ *
+ * @note Memory comes in blocks of at least block_size bytes, which are kept on reset and
+ * reused, so a warmed up arena doesn't touch the system allocator anymore.
+ */
+typedef struct hnd_arena_t
+{
+  hnd_arena_block_t *first;
+  hnd_arena_block_t *current;
+  size_t block_size;
+  unsigned int flags;
+  unsigned int tag;
+
+  /* @note Lets the newest allocation grow or be freed in place */
+  void *last_allocation;
+} hnd_arena_t;
+
+/**
+ * @brief Gets the system's page size.
+ */
+size_t
+hnd_get_page_size
+(
+  void
+);
+
+/**
+ * @brief Maps memory straight from the system, zero filled.
+ *
+ * @note With HND_MEMORY_HUGE_PAGES, reserved huge pages are tried first, then transparent
+ * huge pages, then regular pages.
+ *
+ * @param _size  Specifies the wanted size. Returns the mapped size, rounded up to pages.
+ * @param _flags Specifies HND_MEMORY_* flags.
+ *
+ * @return The mapped memory, or NULL.
+ */
+void *
+hnd_map_memory
+(
+  size_t       *_size,
+  unsigned int  _flags
+);
+
+/**
+ * @brief Unmaps memory from hnd_map_memory.
+ *
+ * @param _memory Specifies the memory.
+ * @param _size   Specifies the size returned by hnd_map_memory.
+ */
+void
+hnd_unmap_memory
+(
+  void   *_memory,
+  size_t  _size
+);
+
+/**
+ * @brief Initialises an arena. No memory is mapped until the first allocation.
+ *
+ * @param _arena      Specifies the arena.
+ * @param _block_size Specifies the minimum block size, 0 for HND_ARENA_DEFAULT_BLOCK_SIZE.
+ * @param _flags      Specifies HND_MEMORY_* flags used when mapping blocks.
+ * @param _tag        Specifies the HND_MEMORY_TAG_* blocks are accounted to.
+ */
+void
+hnd_init_arena
+(
+  hnd_arena_t  *_arena,
+  size_t        _block_size,
+  unsigned int  _flags,
+  unsigned int  _tag
+);
+
+/**
+ * @brief Unmaps every block of an arena.
+ */
+void
+hnd_end_arena
+(
+  hnd_arena_t *_arena
+);
+
+/**
+ * @brief Allocates from an arena.
+ *
+ * @param _arena     Specifies the arena.
+ * @param _size      Specifies the size.
+ * @param _alignment Specifies a power of two alignment, 0 for HND_MEMORY_ALIGNMENT.
+ *
+ * @return The memory, which is not cleared, or NULL.
+ */
+void *
+hnd_push_arena
+(
+  hnd_arena_t *_arena,
+  size_t       _size,
+  size_t       _alignment
+);
+
+/**
+ * @brief Frees everything allocated from an arena, in O(1). Blocks are kept.
+ */
+void
+hnd_reset_arena
+(
+  hnd_arena_t *_arena
+);
+
+/**
+ * @brief Wraps an arena as an allocator.
+ *
+ * @note Frees are no-ops, except for the newest allocation.
+ */
+hnd_allocator_t
+hnd_get_arena_allocator
+(
+  hnd_arena_t *_arena
+);
+
+/**
+ * @brief Gets the heap allocator accounting to a tag.
+ *
+ * @param _tag Specifies an HND_MEMORY_TAG_*.
+ */
+hnd_allocator_t
+hnd_get_tagged_allocator
+(
+  unsigned int _tag
+);
+
+/**
+ * @brief Gets the heap allocator accounting to HND_MEMORY_TAG_GENERAL.
+ */
+hnd_allocator_t
+hnd_get_heap_allocator
+(
+  void
+);
+
+/**
+ * @brief Accounts memory that didn't come from a tagged allocator, e.g. mapped pages.
+ *
+ * @param _tag  Specifies an HND_MEMORY_TAG_*.
+ * @param _size Specifies the size, in bytes.
+ */
+void
+hnd_record_allocation
+(
+  unsigned int _tag,
+  size_t       _size
+);
+
+void
+hnd_record_free
+(
+  unsigned int _tag,
+  size_t       _size
+);
+
+/**
+ * @brief Closes the current frame's allocation counters.
+ *
+ * @note Called by hnd_swap_renderer_buffers.
+ */
+void
+hnd_end_memory_frame
+(
+  void
+);
+
+/**
+ * @brief Gets a snapshot of the memory counters.
+ *
+ * @param _stats Returns the counters.
+ */
+void
+hnd_get_memory_stats
+(
+  hnd_memory_stats_t *_stats
+);
+
+/**
+ * @brief Prints the memory counters, one line per tag.
+ */
+void
+hnd_print_memory_stats
+(
+  void
+);
+
+/**
+ * @brief Prints the tags still holding memory.
+ *
+ * @note Runs at exit on debug builds.
+ *
+ * @return How many allocations are still live.
+ */
+size_t
+hnd_report_memory_leaks
+(
+  void
+);
+
+/* @note Allocation helpers. A NULL allocator uses the heap. */
+void *
+hnd_allocate
+(
+  hnd_allocator_t *_allocator,
+  size_t           _size
+);
+
+void *
+hnd_reallocate
+(
+  hnd_allocator_t *_allocator,
+  void            *_memory,
+  size_t           _old_size,
+  size_t           _new_size
+);
+
+void
+hnd_deallocate
+(
+  hnd_allocator_t *_allocator,
+  void            *_memory,
+  size_t           _size
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_MEMORY_H__ */
@@ -0,0 +1,207 @@
+/**
+ * @file src/core/memory/pool.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "pool.h"
+
+/**
+ * @brief Gets a slot's memory.
+ */
+static inline unsigned char *
+hnd_get_pool_slot
+(
+  hnd_pool_t *_pool,
+  uint32_t    _index
+)
+{
+  return _pool->objects + (size_t)_index * _pool->stride;
+}
+
+int
+hnd_init_pool
+(
+  hnd_pool_t      *_pool,
+  size_t           _object_size,
+  uint32_t         _capacity,
+  hnd_allocator_t *_allocator
+)
+{
+  if (!hnd_assert(_pool != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_capacity > 0 && _capacity <= HND_POOL_MAX_CAPACITY, HND_SYNTAX))
+    return HND_NK;
+
+  /* @note Free slots hold the index of the next one, so they need at least 4 bytes */
+  size_t alignment = sizeof(uint32_t);
+  while (alignment < _object_size && alignment < HND_MEMORY_ALIGNMENT)
+    alignment *= 2;
+
+  _pool->object_size = _object_size;
+  _pool->stride = (_object_size + alignment - 1) & ~(alignment - 1);
+  if (_pool->stride < sizeof(uint32_t))
+    _pool->stride = sizeof(uint32_t);
+  _pool->capacity = _capacity;
+  _pool->count = 0;
+  _pool->allocator = _allocator ? *_allocator : hnd_get_heap_allocator();
+
+  _pool->objects = hnd_allocate(&_pool->allocator, _pool->stride * _capacity);
+  _pool->generations = hnd_allocate(&_pool->allocator, sizeof(uint16_t) * _capacity);
+  if (!hnd_assert(_pool->objects != NULL && _pool->generations != NULL, NULL))
+    return HND_NK;
+
+  memset(_pool->generations, 0x00, sizeof(uint16_t) * _capacity);
+  for (uint32_t i = 0; i < _capacity; ++i)
+  {
+    uint32_t next = i + 1 < _capacity ? i + 1 : HND_POOL_END_OF_LIST;
+    memcpy(hnd_get_pool_slot(_pool, i), &next, sizeof(uint32_t));
+  }
+  _pool->first_free = 0;
+
+  return HND_OK;
+}
+
+void
+hnd_end_pool
+(
+  hnd_pool_t *_pool
+)
+{
+  if (!hnd_assert(_pool != NULL, HND_SYNTAX))
+    return;
+
+  hnd_deallocate(&_pool->allocator, _pool->objects, _pool->stride * _pool->capacity);
+  hnd_deallocate(&_pool->allocator, _pool->generations, sizeof(uint16_t) * _pool->capacity);
+
+  _pool->objects = NULL;
+  _pool->generations = NULL;
+  _pool->capacity = 0;
+  _pool->count = 0;
+  _pool->first_free = HND_POOL_END_OF_LIST;
+}
+
+hnd_handle_t
+hnd_acquire_pool_object
+(
+  hnd_pool_t *_pool
+)
+{
+  if (_pool->first_free == HND_POOL_END_OF_LIST)
+    return HND_INVALID_HANDLE;
+
+  uint32_t index = _pool->first_free;
+  unsigned char *slot = hnd_get_pool_slot(_pool, index);
+  memcpy(&_pool->first_free, slot, sizeof(uint32_t));
+  memset(slot, 0x00, _pool->stride);
+
+  /* @note Even to odd, the slot is now in use. Odd values never mask to 0. */
+  uint32_t generation = ++_pool->generations[index] & HND_HANDLE_GENERATION_MASK;
+  ++_pool->count;
+
+  return (generation << HND_HANDLE_INDEX_BITS) | index;
+}
+
+/**
+ * @brief Checks whether a handle refers to a live object.
+ */
+static int
+hnd_validate_pool_handle
+(
+  hnd_pool_t   *_pool,
+  hnd_handle_t  _handle
+)
+{
+  uint32_t index = _handle & HND_HANDLE_INDEX_MASK;
+  uint32_t generation = _handle >> HND_HANDLE_INDEX_BITS;
+
+  if (_handle == HND_INVALID_HANDLE || index >= _pool->capacity)
+    return HND_NK;
+
+  return (_pool->generations[index] & HND_HANDLE_GENERATION_MASK) == generation;
+}
+
+int
+hnd_release_pool_object
+(
+  hnd_pool_t   *_pool,
+  hnd_handle_t  _handle
+)
+{
+  if (!hnd_validate_pool_handle(_pool, _handle))
+  {
+    hnd_print_debug(HND_WARNING, "Released a stale pool handle", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  uint32_t index = _handle & HND_HANDLE_INDEX_MASK;
+  unsigned char *slot = hnd_get_pool_slot(_pool, index);
+
+#ifdef HND_DEBUG
+  /* @note Poisons the object, so raw pointers kept past the release read garbage */
+  memset(slot, 0xdd, _pool->stride);
+#endif /* HND_DEBUG */
+
+  memcpy(slot, &_pool->first_free, sizeof(uint32_t));
+  _pool->first_free = index;
+
+  ++_pool->generations[index];
+  --_pool->count;
+
+  return HND_OK;
+}
+
+void *
+hnd_get_pool_object
+(
+  hnd_pool_t   *_pool,
+  hnd_handle_t  _handle
+)
+{
+  if (!hnd_validate_pool_handle(_pool, _handle))
+  {
+#ifdef HND_DEBUG
+    if (_handle != HND_INVALID_HANDLE)
+      hnd_print_debug(HND_WARNING, "Used a stale pool handle", HND_FAILURE);
+#endif /* HND_DEBUG */
+
+    return NULL;
+  }
+
+  return hnd_get_pool_slot(_pool, _handle & HND_HANDLE_INDEX_MASK);
+}
+
+hnd_handle_t
+hnd_get_pool_handle
+(
+  hnd_pool_t *_pool,
+  void       *_object
+)
+{
+  unsigned char *object = _object;
+  if (object < _pool->objects || object >= _pool->objects + _pool->stride * _pool->capacity)
+    return HND_INVALID_HANDLE;
+
+  size_t offset = (size_t)(object - _pool->objects);
+  if (offset % _pool->stride)
+    return HND_INVALID_HANDLE;
+
+  uint32_t index = (uint32_t)(offset / _pool->stride);
+  if (!(_pool->generations[index] & 1))
+    return HND_INVALID_HANDLE;
+
+  return ((_pool->generations[index] & HND_HANDLE_GENERATION_MASK) << HND_HANDLE_INDEX_BITS) | index;
+}
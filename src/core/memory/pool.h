@@ -0,0 +1,157 @@
+/**
+ * @file src/core/memory/pool.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Fixed block pools for engine owned objects. Objects are stored contiguously and
+ * referenced through 32 bit generational handles, so a handle to a released object is
+ * detected instead of silently pointing at whatever reused the slot.
+ *
+ * @note Pools aren't thread safe, each one should be used from a single thread.
+ */
+
+#ifndef __HND_POOL_H__
+#define __HND_POOL_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "memory.h"
+
+/**
+ * @brief Generational handle, the slot index on the low bits and its generation on the high ones.
+ *
+ * @note Generations start at 1, so 0 is never a valid handle.
+ */
+typedef uint32_t hnd_handle_t;
+
+#define HND_INVALID_HANDLE 0
+
+#define HND_HANDLE_INDEX_BITS      20
+#define HND_HANDLE_GENERATION_BITS 12
+#define HND_HANDLE_INDEX_MASK      ((1u << HND_HANDLE_INDEX_BITS) - 1)
+#define HND_HANDLE_GENERATION_MASK ((1u << HND_HANDLE_GENERATION_BITS) - 1)
+
+#define HND_POOL_MAX_CAPACITY (1u << HND_HANDLE_INDEX_BITS)
+
+/* @note Marks a free slot on the free list */
+#define HND_POOL_END_OF_LIST 0xffffffff
+
+typedef struct hnd_pool_t
+{
+  unsigned char *objects;
+  size_t stride;
+  size_t object_size;
+  uint32_t capacity;
+  uint32_t count;
+
+  /* @note Slot generations, odd while the slot is in use */
+  uint16_t *generations;
+  /* @note Free slots are chained through their own memory */
+  uint32_t first_free;
+
+  hnd_allocator_t allocator;
+} hnd_pool_t;
+
+/**
+ * @brief Initialises a pool. Its memory is allocated once, pools never grow.
+ *
+ * @param _pool        Specifies the pool.
+ * @param _object_size Specifies the size of each object.
+ * @param _capacity    Specifies how many objects fit, at most HND_POOL_MAX_CAPACITY.
+ * @param _allocator   Specifies where the pool's memory comes from. NULL for the heap.
+ *
+ * @return Function state. HND_OK or HND_NK.
+ */
+int
+hnd_init_pool
+(
+  hnd_pool_t      *_pool,
+  size_t           _object_size,
+  uint32_t         _capacity,
+  hnd_allocator_t *_allocator
+);
+
+/**
+ * @brief Frees a pool's memory. Every handle becomes invalid.
+ */
+void
+hnd_end_pool
+(
+  hnd_pool_t *_pool
+);
+
+/**
+ * @brief Takes an object from a pool, in O(1).
+ *
+ * @param _pool Specifies the pool.
+ *
+ * @return The new object's handle, or HND_INVALID_HANDLE when the pool is full. The object
+ *         is zero filled.
+ */
+hnd_handle_t
+hnd_acquire_pool_object
+(
+  hnd_pool_t *_pool
+);
+
+/**
+ * @brief Gives an object back to its pool, in O(1).
+ *
+ * @param _pool   Specifies the pool.
+ * @param _handle Specifies the object's handle.
+ *
+ * @return Function state. HND_NK if the handle was already released.
+ */
+int
+hnd_release_pool_object
+(
+  hnd_pool_t   *_pool,
+  hnd_handle_t  _handle
+);
+
+/**
+ * @brief Gets the object a handle refers to.
+ *
+ * @note Debug builds report stale handles.
+ *
+ * @return The object, or NULL if the handle is invalid or was released.
+ */
+void *
+hnd_get_pool_object
+(
+  hnd_pool_t   *_pool,
+  hnd_handle_t  _handle
+);
+
+/**
+ * @brief Gets the handle of a live object, from its address.
+ *
+ * @return The handle, or HND_INVALID_HANDLE if the address isn't a live object of the pool.
+ */
+hnd_handle_t
+hnd_get_pool_handle
+(
+  hnd_pool_t *_pool,
+  void       *_object
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_POOL_H__ */
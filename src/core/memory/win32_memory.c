@@ -0,0 +1,92 @@
+/**
+ * @file src/core/memory/win32_memory.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "memory.h"
+#include <windows.h>
+
+size_t
+hnd_get_page_size
+(
+  void
+)
+{
+  static size_t page_size = 0;
+  if (!page_size)
+  {
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    page_size = (size_t)system_info.dwPageSize;
+  }
+
+  return page_size;
+}
+
+void *
+hnd_map_memory
+(
+  size_t       *_size,
+  unsigned int  _flags
+)
+{
+  if (!hnd_assert(_size != NULL, HND_SYNTAX))
+    return NULL;
+
+  void *memory = NULL;
+
+  if (_flags & HND_MEMORY_HUGE_PAGES)
+  {
+    size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size)
+    {
+      size_t size = (*_size + large_page_size - 1) & ~(large_page_size - 1);
+
+      /* @note Fails unless the user holds SeLockMemoryPrivilege */
+      memory = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+      if (memory)
+      {
+        *_size = size;
+
+        return memory;
+      }
+    }
+  }
+
+  size_t page_size = hnd_get_page_size();
+  *_size = (*_size + page_size - 1) & ~(page_size - 1);
+
+  memory = VirtualAlloc(NULL, *_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+  if (!hnd_assert(memory != NULL, "Could not allocate memory"))
+    return NULL;
+
+  return memory;
+}
+
+void
+hnd_unmap_memory
+(
+  void   *_memory,
+  size_t  _size
+)
+{
+  (void)_size;
+
+  if (!_memory)
+    return;
+
+  VirtualFree(_memory, 0, MEM_RELEASE);
+}
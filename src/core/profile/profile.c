@@ -0,0 +1,275 @@
+/**
+ * @file src/core/profile/profile.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "profile.h"
+
+#ifdef HND_PROFILE
+#include "../clock/clock.h"
+#include "../memory/memory.h"
+#include <stdio.h>
+
+/* @note Every buffer ever created, newest first. Buffers outlive their threads so their
+ * zones can still be written out.
+ */
+static hnd_profile_buffer_t *profile_buffers;
+static uint32_t profile_thread_count;
+static uint64_t profile_epoch;
+
+static _Thread_local hnd_profile_buffer_t *thread_buffer;
+
+/**
+ * @brief Gets the calling thread's buffer, creating it on the thread's first zone.
+ */
+static hnd_profile_buffer_t *
+hnd_get_profile_buffer
+(
+  void
+)
+{
+  if (thread_buffer)
+    return thread_buffer;
+
+  size_t size = sizeof(hnd_profile_buffer_t);
+  hnd_profile_buffer_t *buffer = hnd_map_memory(&size, 0);
+  if (!buffer)
+    return NULL;
+
+  buffer->thread_id = __atomic_add_fetch(&profile_thread_count, 1, __ATOMIC_RELAXED);
+  snprintf(buffer->thread_name, HND_PROFILE_THREAD_NAME_SIZE, "thread %u", buffer->thread_id);
+
+  uint64_t no_epoch = 0;
+  __atomic_compare_exchange_n(&profile_epoch, &no_epoch, hnd_get_clock_ticks(), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+
+  buffer->next = __atomic_load_n(&profile_buffers, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&profile_buffers, &buffer->next, buffer, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+  thread_buffer = buffer;
+
+  return buffer;
+}
+
+void
+hnd_init_profiler
+(
+  void
+)
+{
+  hnd_calibrate_clock_ticks(0);
+  __atomic_store_n(&profile_epoch, hnd_get_clock_ticks(), __ATOMIC_RELAXED);
+}
+
+hnd_profile_zone_t
+hnd_begin_profile_zone
+(
+  const char *_name
+)
+{
+  hnd_profile_buffer_t *buffer = hnd_get_profile_buffer();
+  if (buffer)
+    ++buffer->depth;
+
+  hnd_profile_zone_t zone = { _name, hnd_get_clock_ticks() };
+
+  return zone;
+}
+
+void
+hnd_end_profile_zone
+(
+  hnd_profile_zone_t *_zone
+)
+{
+  uint64_t end = hnd_get_clock_ticks();
+
+  hnd_profile_buffer_t *buffer = thread_buffer;
+  if (!buffer)
+    return;
+
+  --buffer->depth;
+
+  uint64_t head = buffer->head;
+  hnd_profile_event_t *event = &buffer->events[head % HND_PROFILE_BUFFER_CAPACITY];
+  event->name = _zone->name;
+  event->begin = _zone->begin;
+  event->end = end;
+  event->depth = buffer->depth;
+
+  /* @note Publishes the event, the exporter never reads past head */
+  __atomic_store_n(&buffer->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void
+hnd_set_profile_thread_name
+(
+  const char *_name
+)
+{
+  hnd_profile_buffer_t *buffer = hnd_get_profile_buffer();
+  if (!buffer || !hnd_assert(_name != NULL, HND_SYNTAX))
+    return;
+
+  snprintf(buffer->thread_name, HND_PROFILE_THREAD_NAME_SIZE, "%s", _name);
+}
+
+/**
+ * @brief Writes a string as a JSON string.
+ */
+static void
+hnd_write_profile_string
+(
+  FILE       *_file,
+  const char *_string
+)
+{
+  fputc('"', _file);
+  for (const char *c = _string; *c; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      fprintf(_file, "\\%c", *c);
+    else if ((unsigned char)*c < 0x20)
+      fprintf(_file, "\\u%04x", (unsigned char)*c);
+    else
+      fputc(*c, _file);
+  }
+  fputc('"', _file);
+}
+
+/**
+ * @brief Gets the trace time of a tick, in microseconds.
+ */
+static double
+hnd_get_profile_time
+(
+  uint64_t _ticks
+)
+{
+  uint64_t epoch = __atomic_load_n(&profile_epoch, __ATOMIC_RELAXED);
+
+  return _ticks > epoch ? (double)hnd_ticks_to_ns(_ticks - epoch) / 1e3 : 0.0;
+}
+
+uint64_t
+hnd_write_profile_trace
+(
+  const char *_path
+)
+{
+  if (!hnd_assert(_path != NULL, HND_SYNTAX))
+    return 0;
+
+  FILE *file = fopen(_path, "w");
+  if (!file)
+  {
+    hnd_print_debug(HND_WARNING, "Could not write the profile trace", _path);
+
+    return 0;
+  }
+
+  /* @note Zones are copied out first, so the writing thread can't overwrite them while
+   * they're being printed.
+   */
+  size_t copy_size = sizeof(hnd_profile_event_t) * HND_PROFILE_BUFFER_CAPACITY;
+  hnd_profile_event_t *copy = hnd_map_memory(&copy_size, 0);
+  if (!copy)
+  {
+    fclose(file);
+
+    return 0;
+  }
+
+  uint64_t written = 0;
+  int first = HND_OK;
+  fprintf(file, "{\"traceEvents\":[\n");
+
+  for (hnd_profile_buffer_t *buffer = __atomic_load_n(&profile_buffers, __ATOMIC_ACQUIRE); buffer; buffer = buffer->next)
+  {
+    uint64_t head = __atomic_load_n(&buffer->head, __ATOMIC_ACQUIRE);
+    uint64_t oldest = head > HND_PROFILE_BUFFER_CAPACITY ? head - HND_PROFILE_BUFFER_CAPACITY : 0;
+    for (uint64_t i = oldest; i < head; ++i)
+      copy[i - oldest] = buffer->events[i % HND_PROFILE_BUFFER_CAPACITY];
+
+    /* @note The slot at head - capacity may be halfway through being overwritten, it
+     * goes along with everything older.
+     */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint64_t new_head = __atomic_load_n(&buffer->head, __ATOMIC_RELAXED);
+    uint64_t valid = new_head >= HND_PROFILE_BUFFER_CAPACITY ? new_head - HND_PROFILE_BUFFER_CAPACITY + 1 : 0;
+    if (valid < oldest)
+      valid = oldest;
+
+    fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+            first ? "" : ",\n",
+            buffer->thread_id);
+    hnd_write_profile_string(file, buffer->thread_name);
+    fprintf(file, "}}");
+    first = HND_NK;
+
+    for (uint64_t i = valid; i < head; ++i)
+    {
+      const hnd_profile_event_t *event = &copy[i - oldest];
+      double begin = hnd_get_profile_time(event->begin);
+      double end = hnd_get_profile_time(event->end);
+
+      fprintf(file, ",\n{\"name\":");
+      hnd_write_profile_string(file, event->name);
+      fprintf(file, ",\"cat\":\"hound\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"depth\":%u}}",
+              begin,
+              end - begin,
+              buffer->thread_id,
+              event->depth);
+      ++written;
+    }
+  }
+
+  fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+  fclose(file);
+  hnd_unmap_memory(copy, copy_size);
+
+  return written;
+}
+#else
+void
+hnd_init_profiler
+(
+  void
+)
+{
+}
+
+void
+hnd_set_profile_thread_name
+(
+  const char *_name
+)
+{
+  (void)_name;
+}
+
+uint64_t
+hnd_write_profile_trace
+(
+  const char *_path
+)
+{
+  (void)_path;
+
+  hnd_print_debug(HND_WARNING, "Profiler compiled out", "Build with HOUND_PROFILE");
+
+  return 0;
+}
+#endif /* HND_PROFILE */
@@ -0,0 +1,149 @@
+/**
+ * @file src/core/profile/profile.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note CPU profiler. HND_PROFILE_SCOPE times the rest of the block it's in and stores it
+ * in the calling thread's ring buffer, without locks. The buffers are written out as a
+ * Chrome trace, which chrome://tracing and ui.perfetto.dev open.
+ *
+ * @note Zones only exist when built with HOUND_PROFILE, otherwise they compile to nothing.
+ */
+
+#ifndef __HND_PROFILE_H__
+#define __HND_PROFILE_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../debug.h"
+#include <stdint.h>
+
+/* @note Zones kept per thread, the oldest are overwritten. 32 bytes each. */
+#define HND_PROFILE_BUFFER_CAPACITY 16384
+
+#define HND_PROFILE_THREAD_NAME_SIZE 32
+
+/**
+ * @brief A finished zone.
+ */
+typedef struct hnd_profile_event_t
+{
+  const char *name;
+  uint64_t begin;
+  uint64_t end;
+  /* @note Zones open around it on the same thread */
+  uint32_t depth;
+  uint32_t reserved;
+} hnd_profile_event_t;
+
+/**
+ * @brief A thread's zones. Only its thread writes, the exporter reads.
+ */
+typedef struct hnd_profile_buffer_t
+{
+  hnd_profile_event_t events[HND_PROFILE_BUFFER_CAPACITY];
+  /* @note Zones ever written, the newest is at (head - 1) % capacity */
+  uint64_t head;
+  uint32_t depth;
+  uint32_t thread_id;
+  char thread_name[HND_PROFILE_THREAD_NAME_SIZE];
+
+  struct hnd_profile_buffer_t *next;
+} hnd_profile_buffer_t;
+
+/**
+ * @brief An open zone, see HND_PROFILE_SCOPE.
+ */
+typedef struct hnd_profile_zone_t
+{
+  const char *name;
+  uint64_t begin;
+} hnd_profile_zone_t;
+
+#ifdef HND_PROFILE
+#define HND_PROFILE_JOIN_NAME(_a, _b) _a##_b
+#define HND_PROFILE_ZONE_NAME(_line) HND_PROFILE_JOIN_NAME(hnd_profile_zone_, _line)
+
+/* @note Ends with the enclosing block, through gcc's cleanup attribute. _name must be a
+ * string that outlives the export, a literal in practice.
+ */
+#define HND_PROFILE_SCOPE(_name)                                                   \
+  hnd_profile_zone_t HND_PROFILE_ZONE_NAME(__LINE__)                               \
+    __attribute__((cleanup(hnd_end_profile_zone))) = hnd_begin_profile_zone(_name)
+
+#define HND_PROFILE_THREAD(_name) hnd_set_profile_thread_name(_name)
+#else
+#define HND_PROFILE_SCOPE(_name) (void)0
+#define HND_PROFILE_THREAD(_name) (void)0
+#endif /* HND_PROFILE */
+
+/**
+ * @brief Calibrates the tick clock and sets the trace's time zero.
+ *
+ * @note Call it before any zone, zones already taken would be in the old ticks. Does
+ * nothing without HOUND_PROFILE.
+ */
+void
+hnd_init_profiler
+(
+  void
+);
+
+hnd_profile_zone_t
+hnd_begin_profile_zone
+(
+  const char *_name
+);
+
+void
+hnd_end_profile_zone
+(
+  hnd_profile_zone_t *_zone
+);
+
+/**
+ * @brief Names the calling thread in the trace.
+ */
+void
+hnd_set_profile_thread_name
+(
+  const char *_name
+);
+
+/**
+ * @brief Writes every thread's zones as a Chrome trace.
+ *
+ * @note Can run while other threads keep profiling. Zones overwritten while being copied
+ * are left out.
+ *
+ * @param _path Specifies the JSON file to write.
+ *
+ * @return The number of zones written, 0 if the file couldn't be written or the profiler
+ *         is compiled out.
+ */
+uint64_t
+hnd_write_profile_trace
+(
+  const char *_path
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_PROFILE_H__ */
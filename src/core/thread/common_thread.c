@@ -0,0 +1,250 @@
+/**
+ * @file src/core/thread/common_thread.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "thread.h"
+
+/**
+ * @brief Worker threads shared by every hnd_parallel_for call.
+ */
+static struct
+{
+  int started;
+  int running;
+  unsigned int worker_count;
+  hnd_thread_t workers[HND_MAX_WORKER_THREADS];
+
+  hnd_mutex_t mutex;
+  hnd_condition_t start_condition;
+  hnd_condition_t done_condition;
+
+  /* @note Bumped on every submission, so workers know there's new work */
+  unsigned long generation;
+  unsigned int pending;
+
+  hnd_parallel_function_t function;
+  void *data;
+  size_t count;
+  size_t grain;
+  unsigned int part_count;
+} pool;
+
+/* @note Held for a whole hnd_parallel_for call, the pool only runs one submission at a
+ * time. Also guards starting and stopping the workers.
+ */
+static hnd_once_t submission_once = HND_ONCE_INIT;
+static hnd_mutex_t submission_mutex;
+
+static void
+hnd_init_submission_mutex
+(
+  void
+)
+{
+  hnd_init_mutex(&submission_mutex);
+}
+
+/**
+ * @brief Gets the range of the current submission assigned to a part.
+ *
+ * @param _part  Specifies the part index, 0 being the calling thread.
+ * @param _begin Specifies where to store the first index.
+ * @param _end   Specifies where to store the index after the last.
+ */
+static void
+hnd_get_part_range
+(
+  unsigned int  _part,
+  size_t       *_begin,
+  size_t       *_end
+)
+{
+  size_t grains = (pool.count + pool.grain - 1) / pool.grain;
+
+  *_begin = (grains * _part / pool.part_count) * pool.grain;
+  *_end = (grains * (_part + 1) / pool.part_count) * pool.grain;
+  if (*_end > pool.count)
+    *_end = pool.count;
+}
+
+static void
+hnd_run_worker
+(
+  void *_part
+)
+{
+  unsigned int part = (unsigned int)(size_t)_part;
+  unsigned long generation = 0;
+
+  hnd_lock_mutex(&pool.mutex);
+  for (;;)
+  {
+    while (pool.running && pool.generation == generation)
+      hnd_wait_condition(&pool.start_condition, &pool.mutex);
+
+    if (!pool.running)
+      break;
+
+    generation = pool.generation;
+    if (part >= pool.part_count)
+      continue;
+
+    size_t begin, end;
+    hnd_get_part_range(part, &begin, &end);
+    hnd_parallel_function_t function = pool.function;
+    void *data = pool.data;
+
+    hnd_unlock_mutex(&pool.mutex);
+    function(begin, end, data);
+    hnd_lock_mutex(&pool.mutex);
+
+    if (--pool.pending == 0)
+      hnd_broadcast_condition(&pool.done_condition);
+  }
+  hnd_unlock_mutex(&pool.mutex);
+}
+
+/**
+ * @brief Starts one worker per extra processor.
+ *
+ * @return Function state. HND_OK or HND_NK.
+ */
+static int
+hnd_start_worker_threads
+(
+  void
+)
+{
+  if (!hnd_init_mutex(&pool.mutex))
+    return HND_NK;
+  if (!hnd_init_condition(&pool.start_condition))
+    return HND_NK;
+  if (!hnd_init_condition(&pool.done_condition))
+    return HND_NK;
+
+  pool.started = HND_OK;
+  pool.running = HND_OK;
+  pool.generation = 0;
+
+  unsigned int worker_count = hnd_get_processor_count() - 1;
+  if (worker_count > HND_MAX_WORKER_THREADS)
+    worker_count = HND_MAX_WORKER_THREADS;
+
+  /* @note Part 0 is always ran by the calling thread */
+  for (pool.worker_count = 0; pool.worker_count < worker_count; ++pool.worker_count)
+  {
+    if (!hnd_create_thread(&pool.workers[pool.worker_count],
+                           hnd_run_worker,
+                           (void *)(size_t)(pool.worker_count + 1)))
+      break;
+  }
+
+  return HND_OK;
+}
+
+void
+hnd_parallel_for
+(
+  size_t                   _count,
+  size_t                   _grain,
+  hnd_parallel_function_t  _function,
+  void                    *_data
+)
+{
+  if (!hnd_assert(_function != NULL, HND_SYNTAX))
+    return;
+  if (_count == 0)
+    return;
+  if (_grain == 0)
+    _grain = 1;
+
+  size_t grains = (_count + _grain - 1) / _grain;
+  if (grains < 2)
+  {
+    _function(0, _count, _data);
+
+    return;
+  }
+
+  hnd_call_once(&submission_once, hnd_init_submission_mutex);
+  hnd_lock_mutex(&submission_mutex);
+
+  if ((!pool.started && !hnd_start_worker_threads()) || pool.worker_count == 0)
+  {
+    hnd_unlock_mutex(&submission_mutex);
+    _function(0, _count, _data);
+
+    return;
+  }
+
+  hnd_lock_mutex(&pool.mutex);
+  pool.function = _function;
+  pool.data = _data;
+  pool.count = _count;
+  pool.grain = _grain;
+  pool.part_count = grains < pool.worker_count + 1 ? (unsigned int)grains : pool.worker_count + 1;
+  pool.pending = pool.part_count - 1;
+  ++pool.generation;
+  hnd_broadcast_condition(&pool.start_condition);
+
+  size_t begin, end;
+  hnd_get_part_range(0, &begin, &end);
+  hnd_unlock_mutex(&pool.mutex);
+
+  _function(begin, end, _data);
+
+  hnd_lock_mutex(&pool.mutex);
+  while (pool.pending > 0)
+    hnd_wait_condition(&pool.done_condition, &pool.mutex);
+  hnd_unlock_mutex(&pool.mutex);
+
+  hnd_unlock_mutex(&submission_mutex);
+}
+
+void
+hnd_end_worker_threads
+(
+  void
+)
+{
+  hnd_call_once(&submission_once, hnd_init_submission_mutex);
+  hnd_lock_mutex(&submission_mutex);
+
+  if (!pool.started)
+  {
+    hnd_unlock_mutex(&submission_mutex);
+
+    return;
+  }
+
+  hnd_lock_mutex(&pool.mutex);
+  pool.running = HND_NK;
+  hnd_broadcast_condition(&pool.start_condition);
+  hnd_unlock_mutex(&pool.mutex);
+
+  for (unsigned int i = 0; i < pool.worker_count; ++i)
+    hnd_join_thread(&pool.workers[i]);
+
+  hnd_end_condition(&pool.done_condition);
+  hnd_end_condition(&pool.start_condition);
+  hnd_end_mutex(&pool.mutex);
+
+  pool.started = HND_NK;
+  pool.worker_count = 0;
+
+  hnd_unlock_mutex(&submission_mutex);
+}
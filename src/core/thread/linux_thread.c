@@ -0,0 +1,160 @@
+/**
+ * @file src/core/thread/linux_thread.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "thread.h"
+#include <unistd.h>
+
+/**
+ * @brief Adapts pthread's entry point to hnd_thread_function_t.
+ */
+static void *
+hnd_run_thread
+(
+  void *_thread
+)
+{
+  hnd_linux_thread_t *thread = (hnd_linux_thread_t *)_thread;
+  thread->function(thread->data);
+
+  return NULL;
+}
+
+int
+hnd_create_thread
+(
+  hnd_thread_t          *_thread,
+  hnd_thread_function_t  _function,
+  void                  *_data
+)
+{
+  if (!hnd_assert(_thread != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_function != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  _thread->function = _function;
+  _thread->data = _data;
+
+  return pthread_create(&_thread->handle, NULL, hnd_run_thread, _thread) == 0;
+}
+
+void
+hnd_join_thread
+(
+  hnd_thread_t *_thread
+)
+{
+  if (!hnd_assert(_thread != NULL, HND_SYNTAX))
+    return;
+
+  pthread_join(_thread->handle, NULL);
+}
+
+unsigned int
+hnd_get_processor_count
+(
+  void
+)
+{
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return count > 0 ? (unsigned int)count : 1;
+}
+
+void
+hnd_call_once
+(
+  hnd_once_t          *_once,
+  hnd_once_function_t  _function
+)
+{
+  pthread_once(&_once->handle, _function);
+}
+
+int
+hnd_init_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  return pthread_mutex_init(&_mutex->handle, NULL) == 0;
+}
+
+void
+hnd_end_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  pthread_mutex_destroy(&_mutex->handle);
+}
+
+void
+hnd_lock_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  pthread_mutex_lock(&_mutex->handle);
+}
+
+void
+hnd_unlock_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  pthread_mutex_unlock(&_mutex->handle);
+}
+
+int
+hnd_init_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  return pthread_cond_init(&_condition->handle, NULL) == 0;
+}
+
+void
+hnd_end_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  pthread_cond_destroy(&_condition->handle);
+}
+
+void
+hnd_wait_condition
+(
+  hnd_condition_t *_condition,
+  hnd_mutex_t     *_mutex
+)
+{
+  pthread_cond_wait(&_condition->handle, &_mutex->handle);
+}
+
+void
+hnd_broadcast_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  pthread_cond_broadcast(&_condition->handle);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file src/core/thread/linux_thread.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#ifndef __HND_LINUX_THREAD_H__
+#define __HND_LINUX_THREAD_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <pthread.h>
+
+/**
+ * @brief Linux thread data.
+ */
+typedef struct hnd_linux_thread_t
+{
+  pthread_t handle;
+
+  hnd_thread_function_t function;
+  void *data;
+} hnd_linux_thread_t;
+
+typedef struct hnd_linux_mutex_t
+{
+  pthread_mutex_t handle;
+} hnd_linux_mutex_t;
+
+typedef struct hnd_linux_condition_t
+{
+  pthread_cond_t handle;
+} hnd_linux_condition_t;
+
+typedef struct hnd_linux_once_t
+{
+  pthread_once_t handle;
+} hnd_linux_once_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_LINUX_THREAD_H__ */
@@ -0,0 +1,215 @@
+/**
+ * @file src/core/thread/thread.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#ifndef __HND_THREAD_H__
+#define __HND_THREAD_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../../core/debug.h"
+#include <stddef.h>
+
+/**
+ * @brief Function ran by a thread.
+ */
+typedef void (*hnd_thread_function_t)(void *_data);
+
+/**
+ * @brief Function ran by hnd_parallel_for over the [_begin, _end) range.
+ */
+typedef void (*hnd_parallel_function_t)(size_t _begin, size_t _end, void *_data);
+
+/**
+ * @brief Function ran by hnd_call_once.
+ */
+typedef void (*hnd_once_function_t)(void);
+
+#ifdef HND_WIN32
+#include "win32_thread.h"
+typedef hnd_win32_thread_t hnd_thread_t;
+typedef hnd_win32_mutex_t hnd_mutex_t;
+typedef hnd_win32_condition_t hnd_condition_t;
+typedef hnd_win32_once_t hnd_once_t;
+#define HND_ONCE_INIT { INIT_ONCE_STATIC_INIT }
+#else
+#include "linux_thread.h"
+typedef hnd_linux_thread_t hnd_thread_t;
+typedef hnd_linux_mutex_t hnd_mutex_t;
+typedef hnd_linux_condition_t hnd_condition_t;
+typedef hnd_linux_once_t hnd_once_t;
+#define HND_ONCE_INIT { PTHREAD_ONCE_INIT }
+#endif /* HND_WIN32 */
+
+/* @note Upper bound of helper threads used by hnd_parallel_for */
+#define HND_MAX_WORKER_THREADS 16
+
+/**
+ * @brief Starts a thread.
+ *
+ * @note The thread struct must outlive the thread, since it holds the function being ran.
+ *
+ * @param _thread   Specifies the thread struct to fill.
+ * @param _function Specifies the function to run on the new thread.
+ * @param _data     Specifies the user data passed to _function.
+ *
+ * @return Function state. HND_OK or HND_NK.
+ */
+int
+hnd_create_thread
+(
+  hnd_thread_t          *_thread,
+  hnd_thread_function_t  _function,
+  void                  *_data
+);
+
+/**
+ * @brief Waits for a thread to finish.
+ *
+ * @param _thread Specifies the thread to wait for.
+ */
+void
+hnd_join_thread
+(
+  hnd_thread_t *_thread
+);
+
+/**
+ * @brief Gets how many logical processors are online.
+ *
+ * @return The processor count, at least 1.
+ */
+unsigned int
+hnd_get_processor_count
+(
+  void
+);
+
+/**
+ * @brief Runs a function exactly once, however many threads get here at the same time.
+ * The others wait until it returns.
+ *
+ * @param _once     Specifies the flag, a static initialised with HND_ONCE_INIT.
+ * @param _function Specifies the function.
+ */
+void
+hnd_call_once
+(
+  hnd_once_t          *_once,
+  hnd_once_function_t  _function
+);
+
+int
+hnd_init_mutex
+(
+  hnd_mutex_t *_mutex
+);
+
+void
+hnd_end_mutex
+(
+  hnd_mutex_t *_mutex
+);
+
+void
+hnd_lock_mutex
+(
+  hnd_mutex_t *_mutex
+);
+
+void
+hnd_unlock_mutex
+(
+  hnd_mutex_t *_mutex
+);
+
+int
+hnd_init_condition
+(
+  hnd_condition_t *_condition
+);
+
+void
+hnd_end_condition
+(
+  hnd_condition_t *_condition
+);
+
+/**
+ * @brief Atomically unlocks _mutex and waits for _condition to be signaled.
+ *
+ * @param _condition Specifies the condition to wait on.
+ * @param _mutex     Specifies the locked mutex guarding the condition.
+ */
+void
+hnd_wait_condition
+(
+  hnd_condition_t *_condition,
+  hnd_mutex_t     *_mutex
+);
+
+/**
+ * @brief Wakes every thread waiting on _condition.
+ *
+ * @param _condition Specifies the condition to signal.
+ */
+void
+hnd_broadcast_condition
+(
+  hnd_condition_t *_condition
+);
+
+/**
+ * @brief Splits [0, _count) between the calling thread and the worker threads.
+ *
+ * @note Workers are started on the first call, and kept waiting afterwards. Split points are
+ * always multiples of _grain, so a range is never smaller than _grain, except for the last one.
+ *
+ * @note Calls from several threads are serialised, each one waits for the ones before it
+ * to finish. _function must not call hnd_parallel_for.
+ *
+ * @param _count    Specifies the size of the range.
+ * @param _grain    Specifies the smallest range worth sending to another thread.
+ * @param _function Specifies the function to run over each range.
+ * @param _data     Specifies the user data passed to _function.
+ */
+void
+hnd_parallel_for
+(
+  size_t                   _count,
+  size_t                   _grain,
+  hnd_parallel_function_t  _function,
+  void                    *_data
+);
+
+/**
+ * @brief Stops the worker threads used by hnd_parallel_for.
+ */
+void
+hnd_end_worker_threads
+(
+  void
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_THREAD_H__ */
@@ -0,0 +1,183 @@
+/**
+ * @file src/core/thread/win32_thread.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "thread.h"
+
+/**
+ * @brief Adapts win32's entry point to hnd_thread_function_t.
+ */
+static DWORD WINAPI
+hnd_run_thread
+(
+  LPVOID _thread
+)
+{
+  hnd_win32_thread_t *thread = (hnd_win32_thread_t *)_thread;
+  thread->function(thread->data);
+
+  return 0;
+}
+
+int
+hnd_create_thread
+(
+  hnd_thread_t          *_thread,
+  hnd_thread_function_t  _function,
+  void                  *_data
+)
+{
+  if (!hnd_assert(_thread != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_function != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  _thread->function = _function;
+  _thread->data = _data;
+  _thread->handle = CreateThread(NULL, 0, hnd_run_thread, _thread, 0, NULL);
+
+  return _thread->handle != NULL;
+}
+
+void
+hnd_join_thread
+(
+  hnd_thread_t *_thread
+)
+{
+  if (!hnd_assert(_thread != NULL, HND_SYNTAX))
+    return;
+
+  WaitForSingleObject(_thread->handle, INFINITE);
+  CloseHandle(_thread->handle);
+}
+
+unsigned int
+hnd_get_processor_count
+(
+  void
+)
+{
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+
+  return system_info.dwNumberOfProcessors > 0 ? system_info.dwNumberOfProcessors : 1;
+}
+
+/**
+ * @brief Adapts win32's one time initialisation callback to hnd_once_function_t.
+ */
+static BOOL CALLBACK
+hnd_run_once
+(
+  PINIT_ONCE  _once,
+  PVOID       _function,
+  PVOID      *_context
+)
+{
+  (*(hnd_once_function_t *)_function)();
+
+  return TRUE;
+}
+
+void
+hnd_call_once
+(
+  hnd_once_t          *_once,
+  hnd_once_function_t  _function
+)
+{
+  InitOnceExecuteOnce(&_once->handle, hnd_run_once, &_function, NULL);
+}
+
+int
+hnd_init_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  InitializeCriticalSection(&_mutex->handle);
+
+  return HND_OK;
+}
+
+void
+hnd_end_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  DeleteCriticalSection(&_mutex->handle);
+}
+
+void
+hnd_lock_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  EnterCriticalSection(&_mutex->handle);
+}
+
+void
+hnd_unlock_mutex
+(
+  hnd_mutex_t *_mutex
+)
+{
+  LeaveCriticalSection(&_mutex->handle);
+}
+
+int
+hnd_init_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  InitializeConditionVariable(&_condition->handle);
+
+  return HND_OK;
+}
+
+void
+hnd_end_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  /* @note Win32 condition variables don't need to be deleted */
+  (void)_condition;
+}
+
+void
+hnd_wait_condition
+(
+  hnd_condition_t *_condition,
+  hnd_mutex_t     *_mutex
+)
+{
+  SleepConditionVariableCS(&_condition->handle, &_mutex->handle, INFINITE);
+}
+
+void
+hnd_broadcast_condition
+(
+  hnd_condition_t *_condition
+)
+{
+  WakeAllConditionVariable(&_condition->handle);
+}
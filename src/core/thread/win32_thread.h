@@ -0,0 +1,59 @@
+/**
+ * @file src/core/thread/win32_thread.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#ifndef __HND_WIN32_THREAD_H__
+#define __HND_WIN32_THREAD_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <windows.h>
+
+/**
+ * @brief Win32 thread data.
+ */
+typedef struct hnd_win32_thread_t
+{
+  HANDLE handle;
+
+  hnd_thread_function_t function;
+  void *data;
+} hnd_win32_thread_t;
+
+typedef struct hnd_win32_mutex_t
+{
+  CRITICAL_SECTION handle;
+} hnd_win32_mutex_t;
+
+typedef struct hnd_win32_condition_t
+{
+  CONDITION_VARIABLE handle;
+} hnd_win32_condition_t;
+
+typedef struct hnd_win32_once_t
+{
+  INIT_ONCE handle;
+} hnd_win32_once_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_WIN32_THREAD_H__ */
@@ -25,11 +25,28 @@ extern "C"
 #endif /* __cplusplus */
 
 #include "core/core.h"
+#include "core/clock/clock.h"
+#include "core/clock/timing.h"
 #include "core/event/event.h"
+#include "core/event/dispatch.h"
+#include "core/event/action.h"
+#include "core/event/joystick.h"
+#include "core/event/record.h"
+#include "core/memory/memory.h"
+#include "core/memory/pool.h"
+#include "core/profile/profile.h"
+#include "core/thread/thread.h"
 #include "util/math/vector.h"
+#include "util/math/compact_vector.h"
+#include "util/math/matrix.h"
+#include "util/math/transform.h"
+#include "util/math/vector_array.h"
+#include "util/math/approx.h"
+#include "util/math/cull.h"
 #include "video/video.h"
 #include "video/renderer/renderer.h"
 #include "video/window/window.h"
+#include "video/run/run.h"
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,844 @@
+/**
+ * @file src/util/math/approx.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "approx.h"
+#include "../../core/cpu.h"
+#include <float.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_APPROX_X86
+#endif /* __x86_64__ || __i386__ */
+
+/* @note pi/2 split in three, so the reduction stays exact for |angle| <= 8192 */
+#define HND_PI_2_HIGH   1.5703125f
+#define HND_PI_2_MEDIUM 4.837512969970703125e-4f
+#define HND_PI_2_LOW    7.54978995489188216e-8f
+#define HND_2_PI        0.63661977236758134f
+
+/* @note Minimax coefficients for [-pi/4, pi/4] */
+#define HND_SIN_C1 -1.6666654611e-1f
+#define HND_SIN_C2  8.3321608736e-3f
+#define HND_SIN_C3 -1.9515295891e-4f
+#define HND_COS_C1  4.166664568298827e-2f
+#define HND_COS_C2 -1.388731625493765e-3f
+#define HND_COS_C3  2.443315711809948e-5f
+
+/**
+ * @brief Set of kernels backing the array functions.
+ */
+typedef struct hnd_approx_kernels_t
+{
+  void (*rcp)(float *, size_t);
+  void (*rsqrt)(float *, size_t);
+  void (*sincos)(float *, float *, float *, size_t);
+  void (*normalize_aos)(float *, size_t);
+  void (*length_aos)(const float *, float *, size_t);
+  void (*normalize_soa)(float *, float *, float *, size_t);
+  void (*length_soa)(const float *, const float *, const float *, float *, size_t);
+} hnd_approx_kernels_t;
+
+/* @note Scalar fallback, also used for the tails of the SIMD kernels */
+static void
+hnd_rcp_stream_scalar
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _values[i] = hnd_rcp_approx(_values[i]);
+}
+
+static void
+hnd_rsqrt_stream_scalar
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _values[i] = hnd_rsqrt_approx(_values[i]);
+}
+
+static void
+hnd_sincos_stream_scalar
+(
+  float  *_angles,
+  float  *_sines,
+  float  *_cosines,
+  size_t  _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    hnd_sincos_approx(_angles[i], &_sines[i], &_cosines[i]);
+}
+
+static void
+hnd_normalize_aos_scalar
+(
+  float  *_vectors,
+  size_t  _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    hnd_normalize_vector_approx(_vectors + i * 4);
+}
+
+static void
+hnd_length_aos_scalar
+(
+  const float *_vectors,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _lengths[i] = hnd_length_vector_approx((float *)_vectors + i * 4);
+}
+
+static void
+hnd_normalize_soa_scalar
+(
+  float  *_x,
+  float  *_y,
+  float  *_z,
+  size_t  _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    hnd_vector_t vector = { _x[i], _y[i], _z ? _z[i] : 0.0f, 0.0f };
+    hnd_normalize_vector_approx(vector);
+
+    _x[i] = vector[0];
+    _y[i] = vector[1];
+    if (_z)
+      _z[i] = vector[2];
+  }
+}
+
+static void
+hnd_length_soa_scalar
+(
+  const float *_x,
+  const float *_y,
+  const float *_z,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    hnd_vector_t vector = { _x[i], _y[i], _z ? _z[i] : 0.0f, 0.0f };
+    _lengths[i] = hnd_length_vector_approx(vector);
+  }
+}
+
+static const hnd_approx_kernels_t scalar_kernels =
+{
+  hnd_rcp_stream_scalar,
+  hnd_rsqrt_stream_scalar,
+  hnd_sincos_stream_scalar,
+  hnd_normalize_aos_scalar,
+  hnd_length_aos_scalar,
+  hnd_normalize_soa_scalar,
+  hnd_length_soa_scalar
+};
+
+#ifdef HND_APPROX_X86
+/* @note SSE2 kernels, 8 floats (or 4 vectors) per iteration. SSE2 is needed for the integer
+ * quadrant math of sincos.
+ */
+__attribute__((target("sse2"))) static inline __m128
+hnd_rcp_sse
+(
+  __m128 _value
+)
+{
+  __m128 estimate = _mm_rcp_ps(_value);
+  return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(_value, estimate)));
+}
+
+__attribute__((target("sse2"))) static inline __m128
+hnd_rsqrt_sse
+(
+  __m128 _value
+)
+{
+  __m128 estimate = _mm_rsqrt_ps(_value);
+  __m128 half = _mm_mul_ps(_mm_set1_ps(0.5f), _value);
+  return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half, _mm_mul_ps(estimate, estimate))));
+}
+
+/**
+ * @brief 1 / length from a squared length, zero where the length is zero.
+ */
+__attribute__((target("sse2"))) static inline __m128
+hnd_inverse_length_sse
+(
+  __m128 _squared
+)
+{
+  return _mm_and_ps(_mm_cmpgt_ps(_squared, _mm_set1_ps(FLT_MIN)), hnd_rsqrt_sse(_squared));
+}
+
+__attribute__((target("sse2"))) static inline void
+hnd_sincos_sse
+(
+  __m128  _angle,
+  __m128 *_sine,
+  __m128 *_cosine
+)
+{
+  __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(_angle, _mm_set1_ps(HND_2_PI)));
+  __m128 j = _mm_cvtepi32_ps(quadrant);
+
+  __m128 r = _mm_sub_ps(_angle, _mm_mul_ps(j, _mm_set1_ps(HND_PI_2_HIGH)));
+  r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(HND_PI_2_MEDIUM)));
+  r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(HND_PI_2_LOW)));
+  __m128 z = _mm_mul_ps(r, r);
+
+  __m128 s = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(HND_SIN_C3)), _mm_set1_ps(HND_SIN_C2));
+  s = _mm_add_ps(_mm_mul_ps(z, s), _mm_set1_ps(HND_SIN_C1));
+  s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), s));
+
+  __m128 c = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(HND_COS_C3)), _mm_set1_ps(HND_COS_C2));
+  c = _mm_add_ps(_mm_mul_ps(z, c), _mm_set1_ps(HND_COS_C1));
+  c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_mul_ps(_mm_mul_ps(z, z), c));
+
+  /* @note Odd quadrants swap sine and cosine, then the quadrant decides the signs */
+  __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+  __m128 sine = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+  __m128 cosine = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+  __m128i sine_sign = _mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30);
+  __m128i cosine_sign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+  *_sine = _mm_xor_ps(sine, _mm_castsi128_ps(sine_sign));
+  *_cosine = _mm_xor_ps(cosine, _mm_castsi128_ps(cosine_sign));
+}
+
+__attribute__((target("sse2"))) static void
+hnd_rcp_stream_sse
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    _mm_storeu_ps(_values + i, hnd_rcp_sse(_mm_loadu_ps(_values + i)));
+    _mm_storeu_ps(_values + i + 4, hnd_rcp_sse(_mm_loadu_ps(_values + i + 4)));
+  }
+
+  hnd_rcp_stream_scalar(_values + i, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_rsqrt_stream_sse
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    _mm_storeu_ps(_values + i, hnd_rsqrt_sse(_mm_loadu_ps(_values + i)));
+    _mm_storeu_ps(_values + i + 4, hnd_rsqrt_sse(_mm_loadu_ps(_values + i + 4)));
+  }
+
+  hnd_rsqrt_stream_scalar(_values + i, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_sincos_stream_sse
+(
+  float  *_angles,
+  float  *_sines,
+  float  *_cosines,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m128 sine[2], cosine[2];
+    hnd_sincos_sse(_mm_loadu_ps(_angles + i), &sine[0], &cosine[0]);
+    hnd_sincos_sse(_mm_loadu_ps(_angles + i + 4), &sine[1], &cosine[1]);
+
+    _mm_storeu_ps(_sines + i, sine[0]);
+    _mm_storeu_ps(_sines + i + 4, sine[1]);
+    _mm_storeu_ps(_cosines + i, cosine[0]);
+    _mm_storeu_ps(_cosines + i + 4, cosine[1]);
+  }
+
+  hnd_sincos_stream_scalar(_angles + i, _sines + i, _cosines + i, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_normalize_aos_sse
+(
+  float  *_vectors,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    float *vectors = _vectors + i * 4;
+    __m128 x = _mm_loadu_ps(vectors);
+    __m128 y = _mm_loadu_ps(vectors + 4);
+    __m128 z = _mm_loadu_ps(vectors + 8);
+    __m128 w = _mm_loadu_ps(vectors + 12);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    __m128 scale = hnd_inverse_length_sse(squared);
+    x = _mm_mul_ps(x, scale);
+    y = _mm_mul_ps(y, scale);
+    z = _mm_mul_ps(z, scale);
+
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(vectors, x);
+    _mm_storeu_ps(vectors + 4, y);
+    _mm_storeu_ps(vectors + 8, z);
+    _mm_storeu_ps(vectors + 12, w);
+  }
+
+  hnd_normalize_aos_scalar(_vectors + i * 4, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_length_aos_sse
+(
+  const float *_vectors,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    const float *vectors = _vectors + i * 4;
+    __m128 x = _mm_loadu_ps(vectors);
+    __m128 y = _mm_loadu_ps(vectors + 4);
+    __m128 z = _mm_loadu_ps(vectors + 8);
+    __m128 w = _mm_loadu_ps(vectors + 12);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    _mm_storeu_ps(_lengths + i, _mm_mul_ps(squared, hnd_inverse_length_sse(squared)));
+  }
+
+  hnd_length_aos_scalar(_vectors + i * 4, _lengths + i, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_normalize_soa_sse
+(
+  float  *_x,
+  float  *_y,
+  float  *_z,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(_x + i);
+    __m128 y = _mm_loadu_ps(_y + i);
+    __m128 z = _z ? _mm_loadu_ps(_z + i) : _mm_setzero_ps();
+
+    __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    __m128 scale = hnd_inverse_length_sse(squared);
+    _mm_storeu_ps(_x + i, _mm_mul_ps(x, scale));
+    _mm_storeu_ps(_y + i, _mm_mul_ps(y, scale));
+    if (_z)
+      _mm_storeu_ps(_z + i, _mm_mul_ps(z, scale));
+  }
+
+  hnd_normalize_soa_scalar(_x + i, _y + i, _z ? _z + i : NULL, _count - i);
+}
+
+__attribute__((target("sse2"))) static void
+hnd_length_soa_sse
+(
+  const float *_x,
+  const float *_y,
+  const float *_z,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(_x + i);
+    __m128 y = _mm_loadu_ps(_y + i);
+    __m128 z = _z ? _mm_loadu_ps(_z + i) : _mm_setzero_ps();
+
+    __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    _mm_storeu_ps(_lengths + i, _mm_mul_ps(squared, hnd_inverse_length_sse(squared)));
+  }
+
+  hnd_length_soa_scalar(_x + i, _y + i, _z ? _z + i : NULL, _lengths + i, _count - i);
+}
+
+static const hnd_approx_kernels_t sse_kernels =
+{
+  hnd_rcp_stream_sse,
+  hnd_rsqrt_stream_sse,
+  hnd_sincos_stream_sse,
+  hnd_normalize_aos_sse,
+  hnd_length_aos_sse,
+  hnd_normalize_soa_sse,
+  hnd_length_soa_sse
+};
+
+/* @note AVX2 kernels, 16 floats (or 8 vectors) per iteration, with fused multiply-adds */
+__attribute__((target("avx2,fma"))) static inline __m256
+hnd_rcp_avx2
+(
+  __m256 _value
+)
+{
+  __m256 estimate = _mm256_rcp_ps(_value);
+  return _mm256_mul_ps(estimate, _mm256_fnmadd_ps(_value, estimate, _mm256_set1_ps(2.0f)));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256
+hnd_rsqrt_avx2
+(
+  __m256 _value
+)
+{
+  __m256 estimate = _mm256_rsqrt_ps(_value);
+  __m256 half = _mm256_mul_ps(_mm256_set1_ps(0.5f), _value);
+  return _mm256_mul_ps(estimate, _mm256_fnmadd_ps(half, _mm256_mul_ps(estimate, estimate), _mm256_set1_ps(1.5f)));
+}
+
+__attribute__((target("avx2,fma"))) static inline __m256
+hnd_inverse_length_avx2
+(
+  __m256 _squared
+)
+{
+  return _mm256_and_ps(_mm256_cmp_ps(_squared, _mm256_set1_ps(FLT_MIN), _CMP_GT_OQ), hnd_rsqrt_avx2(_squared));
+}
+
+__attribute__((target("avx2,fma"))) static inline void
+hnd_sincos_avx2
+(
+  __m256  _angle,
+  __m256 *_sine,
+  __m256 *_cosine
+)
+{
+  __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(_angle, _mm256_set1_ps(HND_2_PI)));
+  __m256 j = _mm256_cvtepi32_ps(quadrant);
+
+  __m256 r = _mm256_fnmadd_ps(j, _mm256_set1_ps(HND_PI_2_HIGH), _angle);
+  r = _mm256_fnmadd_ps(j, _mm256_set1_ps(HND_PI_2_MEDIUM), r);
+  r = _mm256_fnmadd_ps(j, _mm256_set1_ps(HND_PI_2_LOW), r);
+  __m256 z = _mm256_mul_ps(r, r);
+
+  __m256 s = _mm256_fmadd_ps(z, _mm256_set1_ps(HND_SIN_C3), _mm256_set1_ps(HND_SIN_C2));
+  s = _mm256_fmadd_ps(z, s, _mm256_set1_ps(HND_SIN_C1));
+  s = _mm256_fmadd_ps(_mm256_mul_ps(r, z), s, r);
+
+  __m256 c = _mm256_fmadd_ps(z, _mm256_set1_ps(HND_COS_C3), _mm256_set1_ps(HND_COS_C2));
+  c = _mm256_fmadd_ps(z, c, _mm256_set1_ps(HND_COS_C1));
+  c = _mm256_fmadd_ps(_mm256_mul_ps(z, z), c, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+  __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+  __m256 sine = _mm256_blendv_ps(s, c, swap);
+  __m256 cosine = _mm256_blendv_ps(c, s, swap);
+
+  __m256i sine_sign = _mm256_slli_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30);
+  __m256i cosine_sign = _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30);
+  *_sine = _mm256_xor_ps(sine, _mm256_castsi256_ps(sine_sign));
+  *_cosine = _mm256_xor_ps(cosine, _mm256_castsi256_ps(cosine_sign));
+}
+
+/**
+ * @brief Transposes the 4x4 blocks held by each 128 bit lane.
+ */
+#define HND_TRANSPOSE8_PS(_row0, _row1, _row2, _row3)                 \
+  do                                                                  \
+  {                                                                   \
+    __m256 _t0 = _mm256_unpacklo_ps(_row0, _row1);                    \
+    __m256 _t1 = _mm256_unpackhi_ps(_row0, _row1);                    \
+    __m256 _t2 = _mm256_unpacklo_ps(_row2, _row3);                    \
+    __m256 _t3 = _mm256_unpackhi_ps(_row2, _row3);                    \
+    _row0 = _mm256_shuffle_ps(_t0, _t2, _MM_SHUFFLE(1, 0, 1, 0));     \
+    _row1 = _mm256_shuffle_ps(_t0, _t2, _MM_SHUFFLE(3, 2, 3, 2));     \
+    _row2 = _mm256_shuffle_ps(_t1, _t3, _MM_SHUFFLE(1, 0, 1, 0));     \
+    _row3 = _mm256_shuffle_ps(_t1, _t3, _MM_SHUFFLE(3, 2, 3, 2));     \
+  } while (0)
+
+/* @note Vector i goes to the low lane of row i and vector i + 4 to the high one, so after
+ * the transpose each row holds one component of 8 vectors, in order.
+ */
+#define HND_LOAD8_VECTORS(_vectors, _x, _y, _z, _w)                                           \
+  do                                                                                          \
+  {                                                                                           \
+    _x = _mm256_loadu2_m128((_vectors) + 16, (_vectors));                                     \
+    _y = _mm256_loadu2_m128((_vectors) + 20, (_vectors) + 4);                                 \
+    _z = _mm256_loadu2_m128((_vectors) + 24, (_vectors) + 8);                                 \
+    _w = _mm256_loadu2_m128((_vectors) + 28, (_vectors) + 12);                                \
+    HND_TRANSPOSE8_PS(_x, _y, _z, _w);                                                        \
+  } while (0)
+
+__attribute__((target("avx2,fma"))) static void
+hnd_rcp_stream_avx2
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 16 <= _count; i += 16)
+  {
+    _mm256_storeu_ps(_values + i, hnd_rcp_avx2(_mm256_loadu_ps(_values + i)));
+    _mm256_storeu_ps(_values + i + 8, hnd_rcp_avx2(_mm256_loadu_ps(_values + i + 8)));
+  }
+
+  hnd_rcp_stream_sse(_values + i, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_rsqrt_stream_avx2
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 16 <= _count; i += 16)
+  {
+    _mm256_storeu_ps(_values + i, hnd_rsqrt_avx2(_mm256_loadu_ps(_values + i)));
+    _mm256_storeu_ps(_values + i + 8, hnd_rsqrt_avx2(_mm256_loadu_ps(_values + i + 8)));
+  }
+
+  hnd_rsqrt_stream_sse(_values + i, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_sincos_stream_avx2
+(
+  float  *_angles,
+  float  *_sines,
+  float  *_cosines,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 16 <= _count; i += 16)
+  {
+    __m256 sine[2], cosine[2];
+    hnd_sincos_avx2(_mm256_loadu_ps(_angles + i), &sine[0], &cosine[0]);
+    hnd_sincos_avx2(_mm256_loadu_ps(_angles + i + 8), &sine[1], &cosine[1]);
+
+    _mm256_storeu_ps(_sines + i, sine[0]);
+    _mm256_storeu_ps(_sines + i + 8, sine[1]);
+    _mm256_storeu_ps(_cosines + i, cosine[0]);
+    _mm256_storeu_ps(_cosines + i + 8, cosine[1]);
+  }
+
+  hnd_sincos_stream_sse(_angles + i, _sines + i, _cosines + i, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_normalize_aos_avx2
+(
+  float  *_vectors,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    float *vectors = _vectors + i * 4;
+    __m256 x, y, z, w;
+    HND_LOAD8_VECTORS(vectors, x, y, z, w);
+
+    __m256 squared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+    __m256 scale = hnd_inverse_length_avx2(squared);
+    x = _mm256_mul_ps(x, scale);
+    y = _mm256_mul_ps(y, scale);
+    z = _mm256_mul_ps(z, scale);
+
+    HND_TRANSPOSE8_PS(x, y, z, w);
+    _mm256_storeu2_m128(vectors + 16, vectors, x);
+    _mm256_storeu2_m128(vectors + 20, vectors + 4, y);
+    _mm256_storeu2_m128(vectors + 24, vectors + 8, z);
+    _mm256_storeu2_m128(vectors + 28, vectors + 12, w);
+  }
+
+  hnd_normalize_aos_sse(_vectors + i * 4, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_length_aos_avx2
+(
+  const float *_vectors,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    const float *vectors = _vectors + i * 4;
+    __m256 x, y, z, w;
+    HND_LOAD8_VECTORS(vectors, x, y, z, w);
+    (void)w;
+
+    __m256 squared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+    _mm256_storeu_ps(_lengths + i, _mm256_mul_ps(squared, hnd_inverse_length_avx2(squared)));
+  }
+
+  hnd_length_aos_sse(_vectors + i * 4, _lengths + i, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_normalize_soa_avx2
+(
+  float  *_x,
+  float  *_y,
+  float  *_z,
+  size_t  _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 x = _mm256_loadu_ps(_x + i);
+    __m256 y = _mm256_loadu_ps(_y + i);
+    __m256 z = _z ? _mm256_loadu_ps(_z + i) : _mm256_setzero_ps();
+
+    __m256 squared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+    __m256 scale = hnd_inverse_length_avx2(squared);
+    _mm256_storeu_ps(_x + i, _mm256_mul_ps(x, scale));
+    _mm256_storeu_ps(_y + i, _mm256_mul_ps(y, scale));
+    if (_z)
+      _mm256_storeu_ps(_z + i, _mm256_mul_ps(z, scale));
+  }
+
+  hnd_normalize_soa_sse(_x + i, _y + i, _z ? _z + i : NULL, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_length_soa_avx2
+(
+  const float *_x,
+  const float *_y,
+  const float *_z,
+  float       *_lengths,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 x = _mm256_loadu_ps(_x + i);
+    __m256 y = _mm256_loadu_ps(_y + i);
+    __m256 z = _z ? _mm256_loadu_ps(_z + i) : _mm256_setzero_ps();
+
+    __m256 squared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+    _mm256_storeu_ps(_lengths + i, _mm256_mul_ps(squared, hnd_inverse_length_avx2(squared)));
+  }
+
+  hnd_length_soa_sse(_x + i, _y + i, _z ? _z + i : NULL, _lengths + i, _count - i);
+}
+
+static const hnd_approx_kernels_t avx2_kernels =
+{
+  hnd_rcp_stream_avx2,
+  hnd_rsqrt_stream_avx2,
+  hnd_sincos_stream_avx2,
+  hnd_normalize_aos_avx2,
+  hnd_length_aos_avx2,
+  hnd_normalize_soa_avx2,
+  hnd_length_soa_avx2
+};
+#endif /* HND_APPROX_X86 */
+
+static const hnd_approx_kernels_t *kernels = &scalar_kernels;
+
+void
+hnd_select_approx_kernels
+(
+  unsigned int _features
+)
+{
+  kernels = &scalar_kernels;
+
+#ifdef HND_APPROX_X86
+  if ((_features & HND_CPU_AVX2) && (_features & HND_CPU_FMA))
+    kernels = &avx2_kernels;
+  else if (_features & HND_CPU_SSE2)
+    kernels = &sse_kernels;
+#endif /* HND_APPROX_X86 */
+}
+
+__attribute__((constructor)) static void
+hnd_init_approx_kernels
+(
+  void
+)
+{
+  hnd_select_approx_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_sincos_approx
+(
+  float  _angle,
+  float *_sine,
+  float *_cosine
+)
+{
+  float j = nearbyintf(_angle * HND_2_PI);
+  int32_t quadrant = (int32_t)j;
+
+  float r = _angle - j * HND_PI_2_HIGH;
+  r -= j * HND_PI_2_MEDIUM;
+  r -= j * HND_PI_2_LOW;
+  float z = r * r;
+
+  float s = r + r * z * (HND_SIN_C1 + z * (HND_SIN_C2 + z * HND_SIN_C3));
+  float c = 1.0f - 0.5f * z + z * z * (HND_COS_C1 + z * (HND_COS_C2 + z * HND_COS_C3));
+
+  float sine = (quadrant & 1) ? c : s;
+  float cosine = (quadrant & 1) ? s : c;
+
+  if (_sine)
+    *_sine = (quadrant & 2) ? -sine : sine;
+  if (_cosine)
+    *_cosine = ((quadrant + 1) & 2) ? -cosine : cosine;
+}
+
+float
+hnd_length_vector_approx
+(
+  hnd_vector_t _vector
+)
+{
+  float squared = hnd_dot_vector(_vector, _vector);
+  if (squared <= FLT_MIN)
+    return 0.0f;
+
+  return squared * hnd_rsqrt_approx(squared);
+}
+
+void
+hnd_normalize_vector_approx
+(
+  hnd_vector_t _vector
+)
+{
+  float squared = hnd_dot_vector(_vector, _vector);
+  if (squared <= FLT_MIN)
+  {
+    /* @note Matches the SIMD kernels, which zero the vector */
+    _vector[0] = _vector[1] = _vector[2] = 0.0f;
+    return;
+  }
+
+  float scale = hnd_rsqrt_approx(squared);
+  for (int i = 0; i < 3; ++i)
+    _vector[i] *= scale;
+}
+
+void
+hnd_rcp_array
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  kernels->rcp(_values, _count);
+}
+
+void
+hnd_rsqrt_array
+(
+  float  *_values,
+  size_t  _count
+)
+{
+  kernels->rsqrt(_values, _count);
+}
+
+void
+hnd_sincos_array
+(
+  float  *_angles,
+  float  *_sines,
+  float  *_cosines,
+  size_t  _count
+)
+{
+  kernels->sincos(_angles, _sines, _cosines, _count);
+}
+
+void
+hnd_normalize_vector_array
+(
+  hnd_vector_t *_vectors,
+  size_t        _count
+)
+{
+  kernels->normalize_aos((float *)_vectors, _count);
+}
+
+void
+hnd_length_vector_array
+(
+  hnd_vector_t *_vectors,
+  float        *_lengths,
+  size_t        _count
+)
+{
+  kernels->length_aos((const float *)_vectors, _lengths, _count);
+}
+
+void
+hnd_normalize_vector_soa
+(
+  hnd_vector_soa_t *_vectors,
+  size_t            _count
+)
+{
+  kernels->normalize_soa(_vectors->x, _vectors->y, _vectors->z, _count);
+}
+
+void
+hnd_length_vector_soa
+(
+  hnd_vector_soa_t *_vectors,
+  float            *_lengths,
+  size_t            _count
+)
+{
+  kernels->length_soa(_vectors->x, _vectors->y, _vectors->z, _lengths, _count);
+}
@@ -0,0 +1,198 @@
+/**
+ * @file src/util/math/approx.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Approximate math for hot loops where a few ulps don't matter, e.g. particles and
+ * steering. Every function documents its worst error, measured against double precision
+ * over the valid input range. Use the exact functions in vector.h and math.h elsewhere.
+ *
+ * @note The array forms process 8 (SSE) or 16 (AVX2) floats per iteration, picked at
+ * runtime like the other math kernels.
+ */
+
+#ifndef __HND_APPROX_H__
+#define __HND_APPROX_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <math.h>
+#include "vector.h"
+#include "vector_array.h"
+
+/**
+ * @brief Selects the kernels used by the approximate array functions.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_approx_kernels
+(
+  unsigned int _features
+);
+
+/**
+ * @brief Approximate 1 / _value, rcpss refined with one Newton-Raphson step.
+ *
+ * @note Relative error below 2^-22 for finite, normal, non zero inputs.
+ */
+static inline float
+hnd_rcp_approx
+(
+  float _value
+)
+{
+#if defined(__SSE__)
+  float estimate = _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(_value)));
+  return estimate * (2.0f - _value * estimate);
+#else
+  return 1.0f / _value;
+#endif /* __SSE__ */
+}
+
+/**
+ * @brief Approximate 1 / sqrt(_value), rsqrtss refined with one Newton-Raphson step.
+ *
+ * @note Relative error below 2^-21 for finite, normal, positive inputs.
+ */
+static inline float
+hnd_rsqrt_approx
+(
+  float _value
+)
+{
+#if defined(__SSE__)
+  float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_value)));
+  return estimate * (1.5f - 0.5f * _value * estimate * estimate);
+#else
+  return 1.0f / sqrtf(_value);
+#endif /* __SSE__ */
+}
+
+/**
+ * @brief Approximate sine and cosine of the same angle.
+ *
+ * @note Reduces the angle to [-pi/4, pi/4] and evaluates minimax polynomials. Absolute
+ * error below 2^-23 for |_angle| <= 8192, accuracy degrades slowly past that.
+ *
+ * @param _angle  Specifies the angle, in radians.
+ * @param _sine   Returns the sine. Can be NULL.
+ * @param _cosine Returns the cosine. Can be NULL.
+ */
+void
+hnd_sincos_approx
+(
+  float  _angle,
+  float *_sine,
+  float *_cosine
+);
+
+/**
+ * @brief Approximate length of the x, y and z components.
+ *
+ * @note Relative error below 2^-21, lengths under sqrt(FLT_MIN) return 0.
+ */
+float
+hnd_length_vector_approx
+(
+  hnd_vector_t _vector
+);
+
+/**
+ * @brief Approximate normalize, the result's length is within 2^-21 of 1.
+ *
+ * @note Like hnd_normalize_vector, w is untouched and zero length vectors stay zero.
+ */
+void
+hnd_normalize_vector_approx
+(
+  hnd_vector_t _vector
+);
+
+/* @note Array forms, in place unless stated otherwise */
+void
+hnd_rcp_array
+(
+  float  *_values,
+  size_t  _count
+);
+
+void
+hnd_rsqrt_array
+(
+  float  *_values,
+  size_t  _count
+);
+
+/**
+ * @param _angles  Specifies the angles, in radians.
+ * @param _sines   Returns the sines. Can alias _angles.
+ * @param _cosines Returns the cosines.
+ */
+void
+hnd_sincos_array
+(
+  float  *_angles,
+  float  *_sines,
+  float  *_cosines,
+  size_t  _count
+);
+
+void
+hnd_normalize_vector_array
+(
+  hnd_vector_t *_vectors,
+  size_t        _count
+);
+
+void
+hnd_length_vector_array
+(
+  hnd_vector_t *_vectors,
+  float        *_lengths,
+  size_t        _count
+);
+
+/**
+ * @brief Normalizes a structure of arrays.
+ *
+ * @note Uses x, y and, when it isn't NULL, z. w is ignored.
+ */
+void
+hnd_normalize_vector_soa
+(
+  hnd_vector_soa_t *_vectors,
+  size_t            _count
+);
+
+void
+hnd_length_vector_soa
+(
+  hnd_vector_soa_t *_vectors,
+  float            *_lengths,
+  size_t            _count
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_APPROX_H__ */
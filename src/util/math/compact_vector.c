@@ -0,0 +1,523 @@
+/**
+ * @file src/util/math/compact_vector.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "compact_vector.h"
+#include "../../core/cpu.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_COMPACT_VECTOR_X86
+#endif /* __x86_64__ || __i386__ */
+
+/* @note Set at startup, see hnd_select_compact_vector_kernels */
+static int use_f16c = 0;
+
+/**
+ * @brief Converts a float to a half float, rounding to nearest even.
+ */
+static uint16_t
+hnd_float_to_half
+(
+  float _value
+)
+{
+  uint32_t bits;
+  memcpy(&bits, &_value, sizeof(bits));
+
+  uint32_t sign = (bits >> 16) & 0x8000;
+  uint32_t exponent = (bits >> 23) & 0xff;
+  uint32_t mantissa = bits & 0x7fffff;
+
+  /* @note Infinity and NaN */
+  if (exponent == 0xff)
+    return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+
+  int half_exponent = (int)exponent - 127 + 15;
+  if (half_exponent >= 0x1f)
+    return sign | 0x7c00;
+
+  /* @note Too small for a normal half, becomes subnormal or zero */
+  if (half_exponent <= 0)
+  {
+    if (half_exponent < -10)
+      return sign;
+
+    mantissa |= 0x800000;
+    uint32_t shift = 14 - half_exponent;
+    uint32_t half = mantissa >> shift;
+    uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half & 1)))
+      ++half;
+
+    return sign | half;
+  }
+
+  /* @note A carry out of the mantissa correctly bumps the exponent, up to infinity */
+  uint32_t half = ((uint32_t)half_exponent << 10) | (mantissa >> 13);
+  uint32_t remainder = mantissa & 0x1fff;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+    ++half;
+
+  return sign | half;
+}
+
+/**
+ * @brief Converts a half float to a float. Exact.
+ */
+static float
+hnd_half_to_float
+(
+  uint16_t _half
+)
+{
+  uint32_t sign = (uint32_t)(_half & 0x8000) << 16;
+  uint32_t exponent = (_half >> 10) & 0x1f;
+  uint32_t mantissa = _half & 0x3ff;
+  uint32_t bits;
+
+  if (exponent == 0x1f)
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  else if (exponent == 0)
+  {
+    float value = (float)mantissa * (1.0f / 16777216.0f);
+
+    return sign ? -value : value;
+  }
+  else
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+
+  return value;
+}
+
+#ifdef HND_COMPACT_VECTOR_X86
+__attribute__((target("avx,f16c"))) static void
+hnd_pack_half_vec4_array_f16c
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec4_t *_destination,
+  size_t           _count
+)
+{
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+    _mm_storeu_si128((__m128i *)_destination[i],
+                     _mm256_cvtps_ph(_mm256_loadu_ps(_source[i]), _MM_FROUND_TO_NEAREST_INT));
+
+  for (; i < _count; ++i)
+    _mm_storel_epi64((__m128i *)_destination[i], _mm_cvtps_ph(_mm_loadu_ps(_source[i]), _MM_FROUND_TO_NEAREST_INT));
+}
+
+__attribute__((target("avx,f16c"))) static void
+hnd_unpack_half_vec4_array_f16c
+(
+  hnd_half_vec4_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+)
+{
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+    _mm256_storeu_ps(_destination[i], _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)_source[i])));
+
+  for (; i < _count; ++i)
+    _mm_storeu_ps(_destination[i], _mm_cvtph_ps(_mm_loadl_epi64((__m128i *)_source[i])));
+}
+
+__attribute__((target("avx,f16c"))) static void
+hnd_pack_half_vec2_array_f16c
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec2_t *_destination,
+  size_t           _count
+)
+{
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128 xy = _mm_movelh_ps(_mm_loadu_ps(_source[i]), _mm_loadu_ps(_source[i + 1]));
+    _mm_storel_epi64((__m128i *)_destination[i], _mm_cvtps_ph(xy, _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  for (; i < _count; ++i)
+  {
+    int packed = _mm_cvtsi128_si32(_mm_cvtps_ph(_mm_loadu_ps(_source[i]), _MM_FROUND_TO_NEAREST_INT));
+    memcpy(_destination[i], &packed, sizeof(hnd_half_vec2_t));
+  }
+}
+
+__attribute__((target("avx,f16c"))) static void
+hnd_unpack_half_vec2_array_f16c
+(
+  hnd_half_vec2_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+)
+{
+  __m128 zero = _mm_setzero_ps();
+
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128 xy = _mm_cvtph_ps(_mm_loadl_epi64((__m128i *)_source[i]));
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(xy, zero));
+    _mm_storeu_ps(_destination[i + 1], _mm_movehl_ps(zero, xy));
+  }
+
+  for (; i < _count; ++i)
+  {
+    int packed;
+    memcpy(&packed, _source[i], sizeof(hnd_half_vec2_t));
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(_mm_cvtph_ps(_mm_cvtsi32_si128(packed)), zero));
+  }
+}
+#endif /* HND_COMPACT_VECTOR_X86 */
+
+void
+hnd_select_compact_vector_kernels
+(
+  unsigned int _features
+)
+{
+  use_f16c = (_features & HND_CPU_F16C) != 0;
+}
+
+__attribute__((constructor)) static void
+hnd_init_compact_vector_kernels
+(
+  void
+)
+{
+  hnd_select_compact_vector_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_pack_vec2_array
+(
+  hnd_vector_t *_source,
+  hnd_vec2_t   *_destination,
+  size_t        _count
+)
+{
+  size_t i = 0;
+#ifdef __SSE__
+  for (; i + 2 <= _count; i += 2)
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(_mm_loadu_ps(_source[i]), _mm_loadu_ps(_source[i + 1])));
+#endif /* __SSE__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = _source[i][0];
+    _destination[i][1] = _source[i][1];
+  }
+}
+
+void
+hnd_unpack_vec2_array
+(
+  hnd_vec2_t   *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  size_t i = 0;
+#ifdef __SSE__
+  __m128 zero = _mm_setzero_ps();
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128 xy = _mm_loadu_ps(_source[i]);
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(xy, zero));
+    _mm_storeu_ps(_destination[i + 1], _mm_movehl_ps(zero, xy));
+  }
+#endif /* __SSE__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = _source[i][0];
+    _destination[i][1] = _source[i][1];
+    _destination[i][2] = 0.0f;
+    _destination[i][3] = 0.0f;
+  }
+}
+
+void
+hnd_pack_vec3_array
+(
+  hnd_vector_t *_source,
+  hnd_vec3_t   *_destination,
+  size_t        _count
+)
+{
+  size_t i = 0;
+#ifdef __SSE__
+  /* @note 4 vectors in, 3 registers out: [a0 a1 a2 b0] [b1 b2 c0 c1] [c2 d0 d1 d2] */
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 a = _mm_loadu_ps(_source[i]);
+    __m128 b = _mm_loadu_ps(_source[i + 1]);
+    __m128 c = _mm_loadu_ps(_source[i + 2]);
+    __m128 d = _mm_loadu_ps(_source[i + 3]);
+    float *destination = _destination[i];
+
+    __m128 a2b0 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(2, 2, 0, 0));
+    _mm_storeu_ps(destination, _mm_shuffle_ps(a, a2b0, _MM_SHUFFLE(0, 2, 1, 0)));
+    _mm_storeu_ps(destination + 4, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 1)));
+    __m128 c2d0 = _mm_shuffle_ps(c, d, _MM_SHUFFLE(0, 0, 2, 2));
+    _mm_storeu_ps(destination + 8, _mm_shuffle_ps(c2d0, d, _MM_SHUFFLE(2, 1, 2, 0)));
+  }
+#endif /* __SSE__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = _source[i][0];
+    _destination[i][1] = _source[i][1];
+    _destination[i][2] = _source[i][2];
+  }
+}
+
+void
+hnd_unpack_vec3_array
+(
+  hnd_vec3_t   *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  size_t i = 0;
+#ifdef __SSE__
+  __m128 zero = _mm_setzero_ps();
+  for (; i + 4 <= _count; i += 4)
+  {
+    float *source = _source[i];
+    __m128 first = _mm_loadu_ps(source);
+    __m128 second = _mm_loadu_ps(source + 4);
+    __m128 third = _mm_loadu_ps(source + 8);
+
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(first, _mm_unpackhi_ps(first, zero)));
+
+    __m128 b0b0b1b2 = _mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 0, 3, 3));
+    __m128 b2b200 = _mm_shuffle_ps(second, zero, _MM_SHUFFLE(0, 0, 1, 1));
+    _mm_storeu_ps(_destination[i + 1], _mm_shuffle_ps(b0b0b1b2, b2b200, _MM_SHUFFLE(2, 0, 2, 0)));
+
+    __m128 c2c200 = _mm_shuffle_ps(third, zero, _MM_SHUFFLE(0, 0, 0, 0));
+    _mm_storeu_ps(_destination[i + 2], _mm_shuffle_ps(second, c2c200, _MM_SHUFFLE(2, 0, 3, 2)));
+
+    __m128 d2d200 = _mm_shuffle_ps(third, zero, _MM_SHUFFLE(0, 0, 3, 3));
+    _mm_storeu_ps(_destination[i + 3], _mm_shuffle_ps(third, d2d200, _MM_SHUFFLE(2, 0, 2, 1)));
+  }
+#endif /* __SSE__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = _source[i][0];
+    _destination[i][1] = _source[i][1];
+    _destination[i][2] = _source[i][2];
+    _destination[i][3] = 0.0f;
+  }
+}
+
+void
+hnd_pack_half_vec4_array
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec4_t *_destination,
+  size_t           _count
+)
+{
+#ifdef HND_COMPACT_VECTOR_X86
+  if (use_f16c)
+  {
+    hnd_pack_half_vec4_array_f16c(_source, _destination, _count);
+
+    return;
+  }
+#endif /* HND_COMPACT_VECTOR_X86 */
+
+  for (size_t i = 0; i < _count; ++i)
+    for (int j = 0; j < 4; ++j)
+      _destination[i][j] = hnd_float_to_half(_source[i][j]);
+}
+
+void
+hnd_unpack_half_vec4_array
+(
+  hnd_half_vec4_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+)
+{
+#ifdef HND_COMPACT_VECTOR_X86
+  if (use_f16c)
+  {
+    hnd_unpack_half_vec4_array_f16c(_source, _destination, _count);
+
+    return;
+  }
+#endif /* HND_COMPACT_VECTOR_X86 */
+
+  for (size_t i = 0; i < _count; ++i)
+    for (int j = 0; j < 4; ++j)
+      _destination[i][j] = hnd_half_to_float(_source[i][j]);
+}
+
+void
+hnd_pack_half_vec2_array
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec2_t *_destination,
+  size_t           _count
+)
+{
+#ifdef HND_COMPACT_VECTOR_X86
+  if (use_f16c)
+  {
+    hnd_pack_half_vec2_array_f16c(_source, _destination, _count);
+
+    return;
+  }
+#endif /* HND_COMPACT_VECTOR_X86 */
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    _destination[i][0] = hnd_float_to_half(_source[i][0]);
+    _destination[i][1] = hnd_float_to_half(_source[i][1]);
+  }
+}
+
+void
+hnd_unpack_half_vec2_array
+(
+  hnd_half_vec2_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+)
+{
+#ifdef HND_COMPACT_VECTOR_X86
+  if (use_f16c)
+  {
+    hnd_unpack_half_vec2_array_f16c(_source, _destination, _count);
+
+    return;
+  }
+#endif /* HND_COMPACT_VECTOR_X86 */
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    _destination[i][0] = hnd_half_to_float(_source[i][0]);
+    _destination[i][1] = hnd_half_to_float(_source[i][1]);
+    _destination[i][2] = 0.0f;
+    _destination[i][3] = 0.0f;
+  }
+}
+
+/**
+ * @brief Rounds and saturates a value to the int16_t range.
+ *
+ * @note Clamped as a float, lrintf has no defined result for NaN, inf or overflow.
+ *       NaN becomes 0 and infinities saturate.
+ */
+static int16_t
+hnd_float_to_short
+(
+  float _value
+)
+{
+  if (_value != _value)
+    return 0;
+  if (_value >= INT16_MAX)
+    return INT16_MAX;
+  if (_value <= INT16_MIN)
+    return INT16_MIN;
+
+  return (int16_t)lrintf(_value);
+}
+
+void
+hnd_pack_short_vec2_array
+(
+  hnd_vector_t     *_source,
+  hnd_short_vec2_t *_destination,
+  float             _scale,
+  size_t            _count
+)
+{
+  size_t i = 0;
+#ifdef __SSE2__
+  /**
+   * @note cvtps rounds to nearest even like lrintf, but turns NaN and anything past
+   *       INT32 into INT32_MIN. Zero NaN lanes and clamp first, same as the scalar path.
+   */
+  __m128 scale = _mm_set1_ps(_scale);
+  __m128 minimum = _mm_set1_ps((float)INT16_MIN);
+  __m128 maximum = _mm_set1_ps((float)INT16_MAX);
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128 xy = _mm_movelh_ps(_mm_loadu_ps(_source[i]), _mm_loadu_ps(_source[i + 1]));
+    xy = _mm_mul_ps(xy, scale);
+    xy = _mm_and_ps(xy, _mm_cmpord_ps(xy, xy));
+    xy = _mm_min_ps(_mm_max_ps(xy, minimum), maximum);
+    __m128i values = _mm_cvtps_epi32(xy);
+    _mm_storel_epi64((__m128i *)_destination[i], _mm_packs_epi32(values, values));
+  }
+#endif /* __SSE2__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = hnd_float_to_short(_source[i][0] * _scale);
+    _destination[i][1] = hnd_float_to_short(_source[i][1] * _scale);
+  }
+}
+
+void
+hnd_unpack_short_vec2_array
+(
+  hnd_short_vec2_t *_source,
+  hnd_vector_t     *_destination,
+  float             _scale,
+  size_t            _count
+)
+{
+  float inverse_scale = 1.0f / _scale;
+
+  size_t i = 0;
+#ifdef __SSE2__
+  __m128 scale = _mm_set1_ps(inverse_scale);
+  __m128 zero = _mm_setzero_ps();
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128i values = _mm_loadl_epi64((__m128i *)_source[i]);
+    values = _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16);
+    __m128 xy = _mm_mul_ps(_mm_cvtepi32_ps(values), scale);
+    _mm_storeu_ps(_destination[i], _mm_movelh_ps(xy, zero));
+    _mm_storeu_ps(_destination[i + 1], _mm_movehl_ps(zero, xy));
+  }
+#endif /* __SSE2__ */
+
+  for (; i < _count; ++i)
+  {
+    _destination[i][0] = (float)_source[i][0] * inverse_scale;
+    _destination[i][1] = (float)_source[i][1] * inverse_scale;
+    _destination[i][2] = 0.0f;
+    _destination[i][3] = 0.0f;
+  }
+}
@@ -0,0 +1,329 @@
+/**
+ * @file src/util/math/compact_vector.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Smaller vector types, for data that doesn't need all 4 components. A 2d position
+ * stored as hnd_vec2_t takes 8 bytes instead of the 16 of a hnd_vector_t, 4 as a
+ * hnd_half_vec2_t or a hnd_short_vec2_t.
+ *
+ * @note Math is still meant to be done on hnd_vector_t. The pack/unpack functions convert
+ * whole arrays between both representations.
+ */
+
+#ifndef __HND_COMPACT_VECTOR_H__
+#define __HND_COMPACT_VECTOR_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "vector.h"
+
+typedef float hnd_vec2_t[2];
+typedef float hnd_vec3_t[3];
+
+/* @note IEEE 754 binary16 components */
+typedef uint16_t hnd_half_vec2_t[2];
+typedef uint16_t hnd_half_vec4_t[4];
+
+/* @note Fixed point components, see hnd_pack_short_vec2_array */
+typedef int16_t hnd_short_vec2_t[2];
+
+/**
+ * @brief Selects the kernels used by the half float converters.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_compact_vector_kernels
+(
+  unsigned int _features
+);
+
+/**
+ * @brief Packs the x and y components of 4d vectors.
+ *
+ * @param _source      Specifies the vectors to pack.
+ * @param _destination Specifies where to store the packed vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_pack_vec2_array
+(
+  hnd_vector_t *_source,
+  hnd_vec2_t   *_destination,
+  size_t        _count
+);
+
+/**
+ * @brief Unpacks 2d vectors to 4d vectors, z and w are set to zero.
+ *
+ * @param _source      Specifies the vectors to unpack.
+ * @param _destination Specifies where to store the unpacked vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_unpack_vec2_array
+(
+  hnd_vec2_t   *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+);
+
+/**
+ * @brief Packs the x, y and z components of 4d vectors.
+ *
+ * @param _source      Specifies the vectors to pack.
+ * @param _destination Specifies where to store the packed vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_pack_vec3_array
+(
+  hnd_vector_t *_source,
+  hnd_vec3_t   *_destination,
+  size_t        _count
+);
+
+/**
+ * @brief Unpacks 3d vectors to 4d vectors, w is set to zero.
+ *
+ * @param _source      Specifies the vectors to unpack.
+ * @param _destination Specifies where to store the unpacked vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_unpack_vec3_array
+(
+  hnd_vec3_t   *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+);
+
+/**
+ * @brief Converts 4d vectors to half floats, rounding to nearest even.
+ *
+ * @param _source      Specifies the vectors to pack.
+ * @param _destination Specifies where to store the packed vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_pack_half_vec4_array
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec4_t *_destination,
+  size_t           _count
+);
+
+void
+hnd_unpack_half_vec4_array
+(
+  hnd_half_vec4_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+);
+
+/**
+ * @brief Converts the x and y components of 4d vectors to half floats.
+ *
+ * @param _source      Specifies the vectors to pack.
+ * @param _destination Specifies where to store the packed vectors.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_pack_half_vec2_array
+(
+  hnd_vector_t    *_source,
+  hnd_half_vec2_t *_destination,
+  size_t           _count
+);
+
+/**
+ * @brief Unpacks half float 2d vectors to 4d vectors, z and w are set to zero.
+ */
+void
+hnd_unpack_half_vec2_array
+(
+  hnd_half_vec2_t *_source,
+  hnd_vector_t    *_destination,
+  size_t           _count
+);
+
+/**
+ * @brief Converts the x and y components of 4d vectors to 16 bit fixed point.
+ *
+ * @note Each component is stored as round(value * _scale), saturated to the int16_t range.
+ * NaN is stored as 0.
+ * A _scale of 1 stores whole pixels, 16 stores 1/16th of a pixel, and so on.
+ *
+ * @param _source      Specifies the vectors to pack.
+ * @param _destination Specifies where to store the packed vectors.
+ * @param _scale       Specifies the fixed point scale.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_pack_short_vec2_array
+(
+  hnd_vector_t     *_source,
+  hnd_short_vec2_t *_destination,
+  float             _scale,
+  size_t            _count
+);
+
+/**
+ * @brief Unpacks fixed point 2d vectors to 4d vectors, z and w are set to zero.
+ *
+ * @param _source      Specifies the vectors to unpack.
+ * @param _destination Specifies where to store the unpacked vectors.
+ * @param _scale       Specifies the fixed point scale used when packing.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_unpack_short_vec2_array
+(
+  hnd_short_vec2_t *_source,
+  hnd_vector_t     *_destination,
+  float             _scale,
+  size_t            _count
+);
+
+/* @note 2d operations */
+static inline void
+hnd_copy_vec2
+(
+  hnd_vec2_t _source,
+  hnd_vec2_t _destination
+)
+{
+  _destination[0] = _source[0];
+  _destination[1] = _source[1];
+}
+
+static inline void
+hnd_add_vec2
+(
+  hnd_vec2_t _left,
+  hnd_vec2_t _right
+)
+{
+  _left[0] += _right[0];
+  _left[1] += _right[1];
+}
+
+static inline void
+hnd_subtract_vec2
+(
+  hnd_vec2_t _left,
+  hnd_vec2_t _right
+)
+{
+  _left[0] -= _right[0];
+  _left[1] -= _right[1];
+}
+
+static inline void
+hnd_multiply_vec2
+(
+  hnd_vec2_t _left,
+  hnd_vec2_t _right
+)
+{
+  _left[0] *= _right[0];
+  _left[1] *= _right[1];
+}
+
+static inline void
+hnd_divide_vec2
+(
+  hnd_vec2_t _left,
+  hnd_vec2_t _right
+)
+{
+  _left[0] /= _right[0];
+  _left[1] /= _right[1];
+}
+
+/* @note 3d operations */
+static inline void
+hnd_copy_vec3
+(
+  hnd_vec3_t _source,
+  hnd_vec3_t _destination
+)
+{
+  _destination[0] = _source[0];
+  _destination[1] = _source[1];
+  _destination[2] = _source[2];
+}
+
+static inline void
+hnd_add_vec3
+(
+  hnd_vec3_t _left,
+  hnd_vec3_t _right
+)
+{
+  _left[0] += _right[0];
+  _left[1] += _right[1];
+  _left[2] += _right[2];
+}
+
+static inline void
+hnd_subtract_vec3
+(
+  hnd_vec3_t _left,
+  hnd_vec3_t _right
+)
+{
+  _left[0] -= _right[0];
+  _left[1] -= _right[1];
+  _left[2] -= _right[2];
+}
+
+static inline void
+hnd_multiply_vec3
+(
+  hnd_vec3_t _left,
+  hnd_vec3_t _right
+)
+{
+  _left[0] *= _right[0];
+  _left[1] *= _right[1];
+  _left[2] *= _right[2];
+}
+
+static inline void
+hnd_divide_vec3
+(
+  hnd_vec3_t _left,
+  hnd_vec3_t _right
+)
+{
+  _left[0] /= _right[0];
+  _left[1] /= _right[1];
+  _left[2] /= _right[2];
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_COMPACT_VECTOR_H__ */
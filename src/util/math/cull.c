@@ -0,0 +1,679 @@
+/**
+ * @file src/util/math/cull.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "cull.h"
+#include "../../core/cpu.h"
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_CULL_X86
+#endif /* __x86_64__ || __i386__ */
+
+/**
+ * @brief Bounds handed to the kernels. z and extent_z are NULL for 2d data.
+ */
+typedef struct hnd_cull_bounds_t
+{
+  const float *x;
+  const float *y;
+  const float *z;
+  const float *extent_x;
+  const float *extent_y;
+  const float *extent_z;
+  const float *radius;
+} hnd_cull_bounds_t;
+
+/**
+ * @brief Set of kernels backing the culling functions.
+ *
+ * @note Kernels test bounds [_first, _count) and return how many indices they wrote. Rect
+ * parameters are { center x, center y, half width, half height }.
+ */
+typedef struct hnd_cull_kernels_t
+{
+  size_t (*aabb_rect)(const hnd_cull_bounds_t *, size_t, size_t, const float *, uint32_t *);
+  size_t (*circle_rect)(const hnd_cull_bounds_t *, size_t, size_t, const float *, uint32_t *);
+  size_t (*aabb_frustum)(const hnd_cull_bounds_t *, size_t, size_t, const hnd_frustum_t *, uint32_t *);
+  size_t (*sphere_frustum)(const hnd_cull_bounds_t *, size_t, size_t, const hnd_frustum_t *, uint32_t *);
+} hnd_cull_kernels_t;
+
+/* @note Scalar fallback, also used for the tails of the SIMD kernels */
+static size_t
+hnd_cull_aabb_rect_scalar
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  for (size_t i = _first; i < _count; ++i)
+  {
+    int inside = fabsf(_bounds->x[i] - _rect[0]) <= _bounds->extent_x[i] + _rect[2] &&
+                 fabsf(_bounds->y[i] - _rect[1]) <= _bounds->extent_y[i] + _rect[3];
+
+    /* @note Branchless compaction, the slot is overwritten when the box isn't visible */
+    _visible[written] = (uint32_t)i;
+    written += inside;
+  }
+
+  return written;
+}
+
+static size_t
+hnd_cull_circle_rect_scalar
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  for (size_t i = _first; i < _count; ++i)
+  {
+    float dx = fmaxf(fabsf(_bounds->x[i] - _rect[0]) - _rect[2], 0.0f);
+    float dy = fmaxf(fabsf(_bounds->y[i] - _rect[1]) - _rect[3], 0.0f);
+
+    _visible[written] = (uint32_t)i;
+    written += dx * dx + dy * dy <= _bounds->radius[i] * _bounds->radius[i];
+  }
+
+  return written;
+}
+
+static size_t
+hnd_cull_aabb_frustum_scalar
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  for (size_t i = _first; i < _count; ++i)
+  {
+    float z = _bounds->z ? _bounds->z[i] : 0.0f;
+    float extent_z = _bounds->extent_z ? _bounds->extent_z[i] : 0.0f;
+
+    int inside = 1;
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      float distance = plane[0] * _bounds->x[i] + plane[1] * _bounds->y[i] + plane[2] * z + plane[3];
+      float radius = fabsf(plane[0]) * _bounds->extent_x[i] +
+                     fabsf(plane[1]) * _bounds->extent_y[i] +
+                     fabsf(plane[2]) * extent_z;
+      inside &= distance + radius >= 0.0f;
+    }
+
+    _visible[written] = (uint32_t)i;
+    written += inside;
+  }
+
+  return written;
+}
+
+static size_t
+hnd_cull_sphere_frustum_scalar
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  for (size_t i = _first; i < _count; ++i)
+  {
+    float z = _bounds->z ? _bounds->z[i] : 0.0f;
+
+    int inside = 1;
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      float distance = plane[0] * _bounds->x[i] + plane[1] * _bounds->y[i] + plane[2] * z + plane[3];
+      inside &= distance + _bounds->radius[i] >= 0.0f;
+    }
+
+    _visible[written] = (uint32_t)i;
+    written += inside;
+  }
+
+  return written;
+}
+
+static const hnd_cull_kernels_t scalar_kernels =
+{
+  hnd_cull_aabb_rect_scalar,
+  hnd_cull_circle_rect_scalar,
+  hnd_cull_aabb_frustum_scalar,
+  hnd_cull_sphere_frustum_scalar
+};
+
+#ifdef HND_CULL_X86
+/**
+ * @brief Appends the indices whose bit is set in a visibility mask.
+ */
+static inline size_t
+hnd_compact_visible_mask
+(
+  uint32_t     *_visible,
+  size_t        _written,
+  size_t        _index,
+  unsigned int  _mask
+)
+{
+  while (_mask)
+  {
+    _visible[_written++] = (uint32_t)(_index + __builtin_ctz(_mask));
+    _mask &= _mask - 1;
+  }
+
+  return _written;
+}
+
+/* @note SSE kernels, 4 bounds per iteration */
+__attribute__((target("sse"))) static size_t
+hnd_cull_aabb_rect_sse
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 rect_x = _mm_set1_ps(_rect[0]);
+  __m128 rect_y = _mm_set1_ps(_rect[1]);
+  __m128 rect_width = _mm_set1_ps(_rect[2]);
+  __m128 rect_height = _mm_set1_ps(_rect[3]);
+
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 dx = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_bounds->x + i), rect_x));
+    __m128 dy = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_bounds->y + i), rect_y));
+    __m128 inside = _mm_and_ps(_mm_cmple_ps(dx, _mm_add_ps(_mm_loadu_ps(_bounds->extent_x + i), rect_width)),
+                               _mm_cmple_ps(dy, _mm_add_ps(_mm_loadu_ps(_bounds->extent_y + i), rect_height)));
+
+    written = hnd_compact_visible_mask(_visible, written, i, _mm_movemask_ps(inside));
+  }
+
+  return written + hnd_cull_aabb_rect_scalar(_bounds, i, _count, _rect, _visible + written);
+}
+
+__attribute__((target("sse"))) static size_t
+hnd_cull_circle_rect_sse
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 zero = _mm_setzero_ps();
+  __m128 rect_x = _mm_set1_ps(_rect[0]);
+  __m128 rect_y = _mm_set1_ps(_rect[1]);
+  __m128 rect_width = _mm_set1_ps(_rect[2]);
+  __m128 rect_height = _mm_set1_ps(_rect[3]);
+
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 dx = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_bounds->x + i), rect_x));
+    __m128 dy = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_bounds->y + i), rect_y));
+    dx = _mm_max_ps(_mm_sub_ps(dx, rect_width), zero);
+    dy = _mm_max_ps(_mm_sub_ps(dy, rect_height), zero);
+
+    __m128 radius = _mm_loadu_ps(_bounds->radius + i);
+    __m128 inside = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(radius, radius));
+
+    written = hnd_compact_visible_mask(_visible, written, i, _mm_movemask_ps(inside));
+  }
+
+  return written + hnd_cull_circle_rect_scalar(_bounds, i, _count, _rect, _visible + written);
+}
+
+__attribute__((target("sse"))) static size_t
+hnd_cull_aabb_frustum_sse
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(_bounds->x + i);
+    __m128 y = _mm_loadu_ps(_bounds->y + i);
+    __m128 z = _bounds->z ? _mm_loadu_ps(_bounds->z + i) : _mm_setzero_ps();
+    __m128 extent_x = _mm_loadu_ps(_bounds->extent_x + i);
+    __m128 extent_y = _mm_loadu_ps(_bounds->extent_y + i);
+    __m128 extent_z = _bounds->extent_z ? _mm_loadu_ps(_bounds->extent_z + i) : _mm_setzero_ps();
+
+    __m128 outside = _mm_setzero_ps();
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane[0])),
+                                              _mm_mul_ps(y, _mm_set1_ps(plane[1]))),
+                                   _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane[2])), _mm_set1_ps(plane[3])));
+      __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(extent_x, _mm_set1_ps(fabsf(plane[0]))),
+                                            _mm_mul_ps(extent_y, _mm_set1_ps(fabsf(plane[1])))),
+                                 _mm_mul_ps(extent_z, _mm_set1_ps(fabsf(plane[2]))));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+    }
+
+    written = hnd_compact_visible_mask(_visible, written, i, ~_mm_movemask_ps(outside) & 0xf);
+  }
+
+  return written + hnd_cull_aabb_frustum_scalar(_bounds, i, _count, _frustum, _visible + written);
+}
+
+__attribute__((target("sse"))) static size_t
+hnd_cull_sphere_frustum_sse
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(_bounds->x + i);
+    __m128 y = _mm_loadu_ps(_bounds->y + i);
+    __m128 z = _bounds->z ? _mm_loadu_ps(_bounds->z + i) : _mm_setzero_ps();
+    __m128 radius = _mm_loadu_ps(_bounds->radius + i);
+
+    __m128 outside = _mm_setzero_ps();
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane[0])),
+                                              _mm_mul_ps(y, _mm_set1_ps(plane[1]))),
+                                   _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane[2])), _mm_set1_ps(plane[3])));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+    }
+
+    written = hnd_compact_visible_mask(_visible, written, i, ~_mm_movemask_ps(outside) & 0xf);
+  }
+
+  return written + hnd_cull_sphere_frustum_scalar(_bounds, i, _count, _frustum, _visible + written);
+}
+
+static const hnd_cull_kernels_t sse_kernels =
+{
+  hnd_cull_aabb_rect_sse,
+  hnd_cull_circle_rect_sse,
+  hnd_cull_aabb_frustum_sse,
+  hnd_cull_sphere_frustum_sse
+};
+
+/* @note AVX2 kernels, 8 bounds per iteration. Visible indices are compacted with a
+ * permutation table instead of a loop over the mask bits: entry n holds, one per byte, the
+ * positions of the bits set in n.
+ */
+static uint64_t compact_table[256];
+
+static void
+hnd_init_compact_table
+(
+  void
+)
+{
+  for (unsigned int mask = 0; mask < 256; ++mask)
+  {
+    uint64_t entry = 0;
+    int slot = 0;
+    for (int bit = 0; bit < 8; ++bit)
+      if (mask & (1u << bit))
+        entry |= (uint64_t)bit << (8 * slot++);
+
+    compact_table[mask] = entry;
+  }
+}
+
+/**
+ * @brief Appends the indices whose bit is set in a visibility mask.
+ *
+ * @note Always stores 8 indices, the caller guarantees _written + 8 fits, see the kernels.
+ */
+__attribute__((target("avx2,fma"))) static inline size_t
+hnd_compact_visible_avx2
+(
+  uint32_t     *_visible,
+  size_t        _written,
+  size_t        _index,
+  unsigned int  _mask
+)
+{
+  __m256i offsets = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long)compact_table[_mask]));
+  _mm256_storeu_si256((__m256i *)(_visible + _written), _mm256_add_epi32(_mm256_set1_epi32((int)_index), offsets));
+
+  return _written + __builtin_popcount(_mask);
+}
+
+/* @note Kernels start with _first = 0, so written <= i and every 8 wide store stays within
+ * the _count indices the caller provides.
+ */
+__attribute__((target("avx2,fma"))) static size_t
+hnd_cull_aabb_rect_avx2
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 rect_x = _mm256_set1_ps(_rect[0]);
+  __m256 rect_y = _mm256_set1_ps(_rect[1]);
+  __m256 rect_width = _mm256_set1_ps(_rect[2]);
+  __m256 rect_height = _mm256_set1_ps(_rect[3]);
+
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 dx = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(_bounds->x + i), rect_x));
+    __m256 dy = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(_bounds->y + i), rect_y));
+    __m256 inside = _mm256_and_ps(
+      _mm256_cmp_ps(dx, _mm256_add_ps(_mm256_loadu_ps(_bounds->extent_x + i), rect_width), _CMP_LE_OQ),
+      _mm256_cmp_ps(dy, _mm256_add_ps(_mm256_loadu_ps(_bounds->extent_y + i), rect_height), _CMP_LE_OQ));
+
+    written = hnd_compact_visible_avx2(_visible, written, i, _mm256_movemask_ps(inside));
+  }
+
+  return written + hnd_cull_aabb_rect_scalar(_bounds, i, _count, _rect, _visible + written);
+}
+
+__attribute__((target("avx2,fma"))) static size_t
+hnd_cull_circle_rect_avx2
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const float             *_rect,
+  uint32_t                *_visible
+)
+{
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 zero = _mm256_setzero_ps();
+  __m256 rect_x = _mm256_set1_ps(_rect[0]);
+  __m256 rect_y = _mm256_set1_ps(_rect[1]);
+  __m256 rect_width = _mm256_set1_ps(_rect[2]);
+  __m256 rect_height = _mm256_set1_ps(_rect[3]);
+
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 dx = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(_bounds->x + i), rect_x));
+    __m256 dy = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(_bounds->y + i), rect_y));
+    dx = _mm256_max_ps(_mm256_sub_ps(dx, rect_width), zero);
+    dy = _mm256_max_ps(_mm256_sub_ps(dy, rect_height), zero);
+
+    __m256 radius = _mm256_loadu_ps(_bounds->radius + i);
+    __m256 inside = _mm256_cmp_ps(_mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy)),
+                                  _mm256_mul_ps(radius, radius),
+                                  _CMP_LE_OQ);
+
+    written = hnd_compact_visible_avx2(_visible, written, i, _mm256_movemask_ps(inside));
+  }
+
+  return written + hnd_cull_circle_rect_scalar(_bounds, i, _count, _rect, _visible + written);
+}
+
+__attribute__((target("avx2,fma"))) static size_t
+hnd_cull_aabb_frustum_avx2
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 x = _mm256_loadu_ps(_bounds->x + i);
+    __m256 y = _mm256_loadu_ps(_bounds->y + i);
+    __m256 z = _bounds->z ? _mm256_loadu_ps(_bounds->z + i) : _mm256_setzero_ps();
+    __m256 extent_x = _mm256_loadu_ps(_bounds->extent_x + i);
+    __m256 extent_y = _mm256_loadu_ps(_bounds->extent_y + i);
+    __m256 extent_z = _bounds->extent_z ? _mm256_loadu_ps(_bounds->extent_z + i) : _mm256_setzero_ps();
+
+    __m256 outside = _mm256_setzero_ps();
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      __m256 distance = _mm256_fmadd_ps(x, _mm256_set1_ps(plane[0]),
+                        _mm256_fmadd_ps(y, _mm256_set1_ps(plane[1]),
+                        _mm256_fmadd_ps(z, _mm256_set1_ps(plane[2]), _mm256_set1_ps(plane[3]))));
+      __m256 radius = _mm256_fmadd_ps(extent_x, _mm256_set1_ps(fabsf(plane[0])),
+                      _mm256_fmadd_ps(extent_y, _mm256_set1_ps(fabsf(plane[1])),
+                      _mm256_mul_ps(extent_z, _mm256_set1_ps(fabsf(plane[2])))));
+      outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+
+    written = hnd_compact_visible_avx2(_visible, written, i, ~_mm256_movemask_ps(outside) & 0xff);
+  }
+
+  return written + hnd_cull_aabb_frustum_scalar(_bounds, i, _count, _frustum, _visible + written);
+}
+
+__attribute__((target("avx2,fma"))) static size_t
+hnd_cull_sphere_frustum_avx2
+(
+  const hnd_cull_bounds_t *_bounds,
+  size_t                   _first,
+  size_t                   _count,
+  const hnd_frustum_t     *_frustum,
+  uint32_t                *_visible
+)
+{
+  size_t written = 0;
+  size_t i = _first;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 x = _mm256_loadu_ps(_bounds->x + i);
+    __m256 y = _mm256_loadu_ps(_bounds->y + i);
+    __m256 z = _bounds->z ? _mm256_loadu_ps(_bounds->z + i) : _mm256_setzero_ps();
+    __m256 radius = _mm256_loadu_ps(_bounds->radius + i);
+
+    __m256 outside = _mm256_setzero_ps();
+    for (int j = 0; j < 6; ++j)
+    {
+      const float *plane = _frustum->planes[j];
+      __m256 distance = _mm256_fmadd_ps(x, _mm256_set1_ps(plane[0]),
+                        _mm256_fmadd_ps(y, _mm256_set1_ps(plane[1]),
+                        _mm256_fmadd_ps(z, _mm256_set1_ps(plane[2]), _mm256_set1_ps(plane[3]))));
+      outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+
+    written = hnd_compact_visible_avx2(_visible, written, i, ~_mm256_movemask_ps(outside) & 0xff);
+  }
+
+  return written + hnd_cull_sphere_frustum_scalar(_bounds, i, _count, _frustum, _visible + written);
+}
+
+static const hnd_cull_kernels_t avx2_kernels =
+{
+  hnd_cull_aabb_rect_avx2,
+  hnd_cull_circle_rect_avx2,
+  hnd_cull_aabb_frustum_avx2,
+  hnd_cull_sphere_frustum_avx2
+};
+#endif /* HND_CULL_X86 */
+
+static const hnd_cull_kernels_t *kernels = &scalar_kernels;
+
+void
+hnd_select_cull_kernels
+(
+  unsigned int _features
+)
+{
+  kernels = &scalar_kernels;
+
+#ifdef HND_CULL_X86
+  if ((_features & HND_CPU_AVX2) && (_features & HND_CPU_FMA))
+    kernels = &avx2_kernels;
+  else if (_features & HND_CPU_SSE)
+    kernels = &sse_kernels;
+#endif /* HND_CULL_X86 */
+}
+
+__attribute__((constructor)) static void
+hnd_init_cull_kernels
+(
+  void
+)
+{
+#ifdef HND_CULL_X86
+  hnd_init_compact_table();
+#endif /* HND_CULL_X86 */
+
+  hnd_select_cull_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_extract_frustum
+(
+  hnd_matrix_t   _matrix,
+  hnd_frustum_t *_frustum
+)
+{
+  /* @note Planes are sums of the matrix rows, the matrix being column major */
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      _frustum->planes[i * 2][j] = _matrix[j * 4 + 3] + _matrix[j * 4 + i];
+      _frustum->planes[i * 2 + 1][j] = _matrix[j * 4 + 3] - _matrix[j * 4 + i];
+    }
+  }
+
+  for (int i = 0; i < 6; ++i)
+  {
+    float length = hnd_length_vector(_frustum->planes[i]);
+    if (length == 0.0f)
+      continue;
+
+    for (int j = 0; j < 4; ++j)
+      _frustum->planes[i][j] /= length;
+  }
+}
+
+size_t
+hnd_cull_aabb_rect
+(
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  hnd_vector_t      _rect,
+  uint32_t         *_visible
+)
+{
+  hnd_cull_bounds_t bounds = { _centers->x, _centers->y, NULL, _extents->x, _extents->y, NULL, NULL };
+  float rect[4] =
+  {
+    (_rect[0] + _rect[2]) * 0.5f,
+    (_rect[1] + _rect[3]) * 0.5f,
+    (_rect[2] - _rect[0]) * 0.5f,
+    (_rect[3] - _rect[1]) * 0.5f
+  };
+
+  return kernels->aabb_rect(&bounds, 0, _count, rect, _visible);
+}
+
+size_t
+hnd_cull_circle_rect
+(
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  hnd_vector_t      _rect,
+  uint32_t         *_visible
+)
+{
+  hnd_cull_bounds_t bounds = { _centers->x, _centers->y, NULL, NULL, NULL, NULL, _radii };
+  float rect[4] =
+  {
+    (_rect[0] + _rect[2]) * 0.5f,
+    (_rect[1] + _rect[3]) * 0.5f,
+    (_rect[2] - _rect[0]) * 0.5f,
+    (_rect[3] - _rect[1]) * 0.5f
+  };
+
+  return kernels->circle_rect(&bounds, 0, _count, rect, _visible);
+}
+
+size_t
+hnd_cull_aabb_frustum
+(
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  hnd_frustum_t    *_frustum,
+  uint32_t         *_visible
+)
+{
+  hnd_cull_bounds_t bounds = { _centers->x, _centers->y, _centers->z, _extents->x, _extents->y, _extents->z, NULL };
+
+  return kernels->aabb_frustum(&bounds, 0, _count, _frustum, _visible);
+}
+
+size_t
+hnd_cull_sphere_frustum
+(
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  hnd_frustum_t    *_frustum,
+  uint32_t         *_visible
+)
+{
+  hnd_cull_bounds_t bounds = { _centers->x, _centers->y, _centers->z, NULL, NULL, NULL, _radii };
+
+  return kernels->sphere_frustum(&bounds, 0, _count, _frustum, _visible);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file src/util/math/cull.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Visibility tests for many bounds at once, so off screen objects never reach the
+ * renderer. Bounds are structures of arrays, z may be NULL for 2d data, and the result is
+ * a compacted list of the indices that passed.
+ *
+ * @note Tests are conservative: an AABB near a frustum corner may be kept although it's
+ * outside, but nothing visible is ever dropped.
+ */
+
+#ifndef __HND_CULL_H__
+#define __HND_CULL_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "vector.h"
+#include "vector_array.h"
+#include "matrix.h"
+
+/**
+ * @brief View frustum, as 6 planes facing inwards.
+ *
+ * @note Each plane is { a, b, c, d }, with points inside when a*x + b*y + c*z + d >= 0.
+ */
+typedef struct hnd_frustum_t
+{
+  hnd_vector_t planes[6];
+} hnd_frustum_t;
+
+/**
+ * @brief Selects the kernels used by the culling functions.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_cull_kernels
+(
+  unsigned int _features
+);
+
+/**
+ * @brief Extracts the frustum planes of a projection, or projection * view, matrix.
+ *
+ * @param _matrix  Specifies the matrix, with OpenGL's -1 to 1 depth range.
+ * @param _frustum Returns the normalized planes.
+ */
+void
+hnd_extract_frustum
+(
+  hnd_matrix_t   _matrix,
+  hnd_frustum_t *_frustum
+);
+
+/**
+ * @brief Culls 2d AABBs against a rectangle.
+ *
+ * @param _centers Specifies the box centers. Only x and y are used.
+ * @param _extents Specifies the box half sizes. Only x and y are used.
+ * @param _count   Specifies how many boxes there are.
+ * @param _rect    Specifies the view rectangle, as { min x, min y, max x, max y }.
+ * @param _visible Returns the indices of the boxes overlapping the rectangle. Must hold
+ *                 _count indices.
+ *
+ * @return How many indices were written to _visible.
+ */
+size_t
+hnd_cull_aabb_rect
+(
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  hnd_vector_t      _rect,
+  uint32_t         *_visible
+);
+
+/**
+ * @brief Culls circles against a rectangle. See hnd_cull_aabb_rect.
+ *
+ * @param _radii Specifies the circle radii.
+ */
+size_t
+hnd_cull_circle_rect
+(
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  hnd_vector_t      _rect,
+  uint32_t         *_visible
+);
+
+/**
+ * @brief Culls AABBs against a frustum. See hnd_cull_aabb_rect.
+ *
+ * @note When z is NULL the boxes are flat, lying on the z = 0 plane.
+ */
+size_t
+hnd_cull_aabb_frustum
+(
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  hnd_frustum_t    *_frustum,
+  uint32_t         *_visible
+);
+
+/**
+ * @brief Culls spheres, or circles when z is NULL, against a frustum. See hnd_cull_aabb_rect.
+ */
+size_t
+hnd_cull_sphere_frustum
+(
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  hnd_frustum_t    *_frustum,
+  uint32_t         *_visible
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_CULL_H__ */
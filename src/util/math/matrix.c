@@ -0,0 +1,715 @@
+/**
+ * @file src/util/math/matrix.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "matrix.h"
+#include "../../core/cpu.h"
+#include "../../core/debug.h"
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_MATRIX_X86
+#endif /* __x86_64__ || __i386__ */
+
+/**
+ * @brief Set of kernels backing the hot matrix operations.
+ *
+ * @note Multiplication kernels never alias, hnd_multiply_matrix takes care of it.
+ */
+typedef struct hnd_matrix_kernels_t
+{
+  void (*multiply)(float *, const float *, const float *);
+  void (*transform_points)(const float *, hnd_vector_t *, hnd_vector_t *, size_t);
+  void (*transform_affine_points)(const float *, hnd_vec2_t *, hnd_vec2_t *, size_t);
+} hnd_matrix_kernels_t;
+
+/* @note Scalar fallback */
+static void
+hnd_multiply_matrix_scalar
+(
+  float       *_result,
+  const float *_left,
+  const float *_right
+)
+{
+  for (int column = 0; column < 4; ++column)
+    for (int row = 0; row < 4; ++row)
+      _result[column * 4 + row] = _left[row] * _right[column * 4] +
+                                  _left[4 + row] * _right[column * 4 + 1] +
+                                  _left[8 + row] * _right[column * 4 + 2] +
+                                  _left[12 + row] * _right[column * 4 + 3];
+}
+
+static void
+hnd_transform_points_scalar
+(
+  const float  *_matrix,
+  hnd_vector_t *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    float x = _source[i][0], y = _source[i][1], z = _source[i][2], w = _source[i][3];
+
+    for (int row = 0; row < 4; ++row)
+      _destination[i][row] = _matrix[row] * x + _matrix[4 + row] * y + _matrix[8 + row] * z + _matrix[12 + row] * w;
+  }
+}
+
+static void
+hnd_transform_affine_points_scalar
+(
+  const float *_affine,
+  hnd_vec2_t  *_source,
+  hnd_vec2_t  *_destination,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    float x = _source[i][0], y = _source[i][1];
+
+    _destination[i][0] = _affine[0] * x + _affine[2] * y + _affine[4];
+    _destination[i][1] = _affine[1] * x + _affine[3] * y + _affine[5];
+  }
+}
+
+static const hnd_matrix_kernels_t scalar_kernels =
+{
+  hnd_multiply_matrix_scalar,
+  hnd_transform_points_scalar,
+  hnd_transform_affine_points_scalar
+};
+
+#ifdef HND_MATRIX_X86
+/* @note SSE kernels, one column or point per iteration */
+__attribute__((target("sse"))) static void
+hnd_multiply_matrix_sse
+(
+  float       *_result,
+  const float *_left,
+  const float *_right
+)
+{
+  __m128 column0 = _mm_loadu_ps(_left);
+  __m128 column1 = _mm_loadu_ps(_left + 4);
+  __m128 column2 = _mm_loadu_ps(_left + 8);
+  __m128 column3 = _mm_loadu_ps(_left + 12);
+
+  for (int column = 0; column < 4; ++column)
+  {
+    const float *right = _right + column * 4;
+    __m128 result = _mm_mul_ps(column0, _mm_set1_ps(right[0]));
+    result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(right[1])));
+    result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(right[2])));
+    result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_set1_ps(right[3])));
+    _mm_storeu_ps(_result + column * 4, result);
+  }
+}
+
+__attribute__((target("sse"))) static void
+hnd_transform_points_sse
+(
+  const float  *_matrix,
+  hnd_vector_t *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  __m128 column0 = _mm_loadu_ps(_matrix);
+  __m128 column1 = _mm_loadu_ps(_matrix + 4);
+  __m128 column2 = _mm_loadu_ps(_matrix + 8);
+  __m128 column3 = _mm_loadu_ps(_matrix + 12);
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    __m128 point = _mm_loadu_ps(_source[i]);
+    __m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(point, point, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(point, point, _MM_SHUFFLE(1, 1, 1, 1))));
+    result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(point, point, _MM_SHUFFLE(2, 2, 2, 2))));
+    result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(point, point, _MM_SHUFFLE(3, 3, 3, 3))));
+    _mm_storeu_ps(_destination[i], result);
+  }
+}
+
+__attribute__((target("sse"))) static void
+hnd_transform_affine_points_sse
+(
+  const float *_affine,
+  hnd_vec2_t  *_source,
+  hnd_vec2_t  *_destination,
+  size_t       _count
+)
+{
+  /* @note Two points per register: [x0 y0 x1 y1] */
+  __m128 linear_x = _mm_setr_ps(_affine[0], _affine[1], _affine[0], _affine[1]);
+  __m128 linear_y = _mm_setr_ps(_affine[2], _affine[3], _affine[2], _affine[3]);
+  __m128 translation = _mm_setr_ps(_affine[4], _affine[5], _affine[4], _affine[5]);
+
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m128 points = _mm_loadu_ps(_source[i]);
+    __m128 x = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 y = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+    _mm_storeu_ps(_destination[i],
+                  _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, linear_x), _mm_mul_ps(y, linear_y)), translation));
+  }
+
+  hnd_transform_affine_points_scalar(_affine, _source + i, _destination + i, _count - i);
+}
+
+static const hnd_matrix_kernels_t sse_kernels =
+{
+  hnd_multiply_matrix_sse,
+  hnd_transform_points_sse,
+  hnd_transform_affine_points_sse
+};
+
+/* @note AVX kernels, two columns or points per iteration (four for 2d points), with fused multiply-adds.
+ *
+ * @note _mm256_permute_ps broadcasts within each 128-bit lane, so a single register holds
+ * one element of two different columns/points.
+ */
+__attribute__((target("avx,fma"))) static void
+hnd_multiply_matrix_avx
+(
+  float       *_result,
+  const float *_left,
+  const float *_right
+)
+{
+  __m256 column0 = _mm256_broadcast_ps((const __m128 *)_left);
+  __m256 column1 = _mm256_broadcast_ps((const __m128 *)(_left + 4));
+  __m256 column2 = _mm256_broadcast_ps((const __m128 *)(_left + 8));
+  __m256 column3 = _mm256_broadcast_ps((const __m128 *)(_left + 12));
+
+  for (int column = 0; column < 4; column += 2)
+  {
+    __m256 right = _mm256_loadu_ps(_right + column * 4);
+    __m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(right, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = _mm256_fmadd_ps(column1, _mm256_permute_ps(right, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = _mm256_fmadd_ps(column2, _mm256_permute_ps(right, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    result = _mm256_fmadd_ps(column3, _mm256_permute_ps(right, _MM_SHUFFLE(3, 3, 3, 3)), result);
+    _mm256_storeu_ps(_result + column * 4, result);
+  }
+}
+
+__attribute__((target("avx,fma"))) static void
+hnd_transform_points_avx
+(
+  const float  *_matrix,
+  hnd_vector_t *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  __m256 column0 = _mm256_broadcast_ps((const __m128 *)_matrix);
+  __m256 column1 = _mm256_broadcast_ps((const __m128 *)(_matrix + 4));
+  __m256 column2 = _mm256_broadcast_ps((const __m128 *)(_matrix + 8));
+  __m256 column3 = _mm256_broadcast_ps((const __m128 *)(_matrix + 12));
+
+  size_t i = 0;
+  for (; i + 2 <= _count; i += 2)
+  {
+    __m256 points = _mm256_loadu_ps(_source[i]);
+    __m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(points, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = _mm256_fmadd_ps(column1, _mm256_permute_ps(points, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = _mm256_fmadd_ps(column2, _mm256_permute_ps(points, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    result = _mm256_fmadd_ps(column3, _mm256_permute_ps(points, _MM_SHUFFLE(3, 3, 3, 3)), result);
+    _mm256_storeu_ps(_destination[i], result);
+  }
+
+  hnd_transform_points_scalar(_matrix, _source + i, _destination + i, _count - i);
+}
+
+__attribute__((target("avx,fma"))) static void
+hnd_transform_affine_points_avx
+(
+  const float *_affine,
+  hnd_vec2_t  *_source,
+  hnd_vec2_t  *_destination,
+  size_t       _count
+)
+{
+  __m256 linear_x = _mm256_setr_ps(_affine[0], _affine[1], _affine[0], _affine[1],
+                                   _affine[0], _affine[1], _affine[0], _affine[1]);
+  __m256 linear_y = _mm256_setr_ps(_affine[2], _affine[3], _affine[2], _affine[3],
+                                   _affine[2], _affine[3], _affine[2], _affine[3]);
+  __m256 translation = _mm256_setr_ps(_affine[4], _affine[5], _affine[4], _affine[5],
+                                      _affine[4], _affine[5], _affine[4], _affine[5]);
+
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m256 points = _mm256_loadu_ps(_source[i]);
+    __m256 result = _mm256_fmadd_ps(_mm256_moveldup_ps(points), linear_x, translation);
+    result = _mm256_fmadd_ps(_mm256_movehdup_ps(points), linear_y, result);
+    _mm256_storeu_ps(_destination[i], result);
+  }
+
+  hnd_transform_affine_points_scalar(_affine, _source + i, _destination + i, _count - i);
+}
+
+static const hnd_matrix_kernels_t avx_kernels =
+{
+  hnd_multiply_matrix_avx,
+  hnd_transform_points_avx,
+  hnd_transform_affine_points_avx
+};
+#endif /* HND_MATRIX_X86 */
+
+static const hnd_matrix_kernels_t *kernels = &scalar_kernels;
+
+void
+hnd_select_matrix_kernels
+(
+  unsigned int _features
+)
+{
+  kernels = &scalar_kernels;
+
+#ifdef HND_MATRIX_X86
+  if ((_features & HND_CPU_AVX) && (_features & HND_CPU_FMA))
+    kernels = &avx_kernels;
+  else if (_features & HND_CPU_SSE)
+    kernels = &sse_kernels;
+#endif /* HND_MATRIX_X86 */
+}
+
+__attribute__((constructor)) static void
+hnd_init_matrix_kernels
+(
+  void
+)
+{
+  hnd_select_matrix_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_identity_matrix
+(
+  hnd_matrix_t _matrix
+)
+{
+  for (int i = 0; i < 16; ++i)
+    _matrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+}
+
+void
+hnd_copy_matrix
+(
+  hnd_matrix_t _source,
+  hnd_matrix_t _destination
+)
+{
+  memcpy(_destination, _source, sizeof(hnd_matrix_t));
+}
+
+void
+hnd_multiply_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _left,
+  hnd_matrix_t _right
+)
+{
+  hnd_matrix_t result;
+  kernels->multiply(result, _left, _right);
+  memcpy(_result, result, sizeof(hnd_matrix_t));
+}
+
+int
+hnd_invert_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _matrix
+)
+{
+  const float *m = _matrix;
+  hnd_matrix_t inverse;
+
+  /* @note Cofactor expansion. Works the same for row and column major, since
+   * inverse(transpose(M)) = transpose(inverse(M)).
+   */
+  inverse[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] +
+               m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+  inverse[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] -
+               m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+  inverse[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] +
+               m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+  inverse[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] -
+                m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+  inverse[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] -
+               m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+  inverse[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] +
+               m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+  inverse[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] -
+               m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+  inverse[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] +
+                m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+  inverse[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] +
+               m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+  inverse[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] -
+               m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+  inverse[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] +
+                m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+  inverse[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] -
+                m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+  inverse[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] -
+               m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+  inverse[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] +
+               m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+  inverse[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] -
+                m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+  inverse[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] +
+                m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+  float determinant = m[0] * inverse[0] + m[1] * inverse[4] + m[2] * inverse[8] + m[3] * inverse[12];
+  if (determinant == 0.0f)
+    return HND_NK;
+
+  float inverse_determinant = 1.0f / determinant;
+  for (int i = 0; i < 16; ++i)
+    _result[i] = inverse[i] * inverse_determinant;
+
+  return HND_OK;
+}
+
+int
+hnd_invert_affine_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _matrix
+)
+{
+  /* @note Invert the 3x3 linear part, then the translation is -inverse(linear) * translation */
+  float a00 = _matrix[0], a01 = _matrix[4], a02 = _matrix[8];
+  float a10 = _matrix[1], a11 = _matrix[5], a12 = _matrix[9];
+  float a20 = _matrix[2], a21 = _matrix[6], a22 = _matrix[10];
+  float x = _matrix[12], y = _matrix[13], z = _matrix[14];
+
+  float cofactor00 = a11 * a22 - a12 * a21;
+  float cofactor01 = a12 * a20 - a10 * a22;
+  float cofactor02 = a10 * a21 - a11 * a20;
+  float determinant = a00 * cofactor00 + a01 * cofactor01 + a02 * cofactor02;
+  if (determinant == 0.0f)
+    return HND_NK;
+
+  float inverse_determinant = 1.0f / determinant;
+  hnd_matrix_t inverse =
+  {
+    cofactor00 * inverse_determinant,
+    cofactor01 * inverse_determinant,
+    cofactor02 * inverse_determinant,
+    0.0f,
+    (a02 * a21 - a01 * a22) * inverse_determinant,
+    (a00 * a22 - a02 * a20) * inverse_determinant,
+    (a01 * a20 - a00 * a21) * inverse_determinant,
+    0.0f,
+    (a01 * a12 - a02 * a11) * inverse_determinant,
+    (a02 * a10 - a00 * a12) * inverse_determinant,
+    (a00 * a11 - a01 * a10) * inverse_determinant,
+    0.0f,
+    0.0f,
+    0.0f,
+    0.0f,
+    1.0f
+  };
+
+  for (int row = 0; row < 3; ++row)
+    inverse[12 + row] = -(inverse[row] * x + inverse[4 + row] * y + inverse[8 + row] * z);
+
+  memcpy(_result, inverse, sizeof(hnd_matrix_t));
+
+  return HND_OK;
+}
+
+void
+hnd_orthographic_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _left,
+  float        _right,
+  float        _bottom,
+  float        _top,
+  float        _near,
+  float        _far
+)
+{
+  hnd_identity_matrix(_matrix);
+
+  _matrix[0] = 2.0f / (_right - _left);
+  _matrix[5] = 2.0f / (_top - _bottom);
+  _matrix[10] = -2.0f / (_far - _near);
+  _matrix[12] = -(_right + _left) / (_right - _left);
+  _matrix[13] = -(_top + _bottom) / (_top - _bottom);
+  _matrix[14] = -(_far + _near) / (_far - _near);
+}
+
+void
+hnd_perspective_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _fov,
+  float        _aspect_ratio,
+  float        _near,
+  float        _far
+)
+{
+  float focal_length = 1.0f / tanf(_fov * 0.5f);
+
+  memset(_matrix, 0x00, sizeof(hnd_matrix_t));
+  _matrix[0] = focal_length / _aspect_ratio;
+  _matrix[5] = focal_length;
+  _matrix[10] = (_far + _near) / (_near - _far);
+  _matrix[11] = -1.0f;
+  _matrix[14] = 2.0f * _far * _near / (_near - _far);
+}
+
+void
+hnd_translation_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _translation
+)
+{
+  hnd_identity_matrix(_matrix);
+
+  _matrix[12] = _translation[0];
+  _matrix[13] = _translation[1];
+  _matrix[14] = _translation[2];
+}
+
+void
+hnd_scale_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _scale
+)
+{
+  hnd_identity_matrix(_matrix);
+
+  _matrix[0] = _scale[0];
+  _matrix[5] = _scale[1];
+  _matrix[10] = _scale[2];
+}
+
+void
+hnd_rotation_z_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _angle
+)
+{
+  float sine = sinf(_angle);
+  float cosine = cosf(_angle);
+
+  hnd_identity_matrix(_matrix);
+
+  _matrix[0] = cosine;
+  _matrix[1] = sine;
+  _matrix[4] = -sine;
+  _matrix[5] = cosine;
+}
+
+void
+hnd_compose_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _position,
+  hnd_vector_t _rotation,
+  hnd_vector_t _scale
+)
+{
+  float x = _rotation[0], y = _rotation[1], z = _rotation[2], w = _rotation[3];
+  float xx = x * x, yy = y * y, zz = z * z;
+  float xy = x * y, xz = x * z, yz = y * z;
+  float wx = w * x, wy = w * y, wz = w * z;
+
+  _matrix[0] = (1.0f - 2.0f * (yy + zz)) * _scale[0];
+  _matrix[1] = 2.0f * (xy + wz) * _scale[0];
+  _matrix[2] = 2.0f * (xz - wy) * _scale[0];
+  _matrix[3] = 0.0f;
+
+  _matrix[4] = 2.0f * (xy - wz) * _scale[1];
+  _matrix[5] = (1.0f - 2.0f * (xx + zz)) * _scale[1];
+  _matrix[6] = 2.0f * (yz + wx) * _scale[1];
+  _matrix[7] = 0.0f;
+
+  _matrix[8] = 2.0f * (xz + wy) * _scale[2];
+  _matrix[9] = 2.0f * (yz - wx) * _scale[2];
+  _matrix[10] = (1.0f - 2.0f * (xx + yy)) * _scale[2];
+  _matrix[11] = 0.0f;
+
+  _matrix[12] = _position[0];
+  _matrix[13] = _position[1];
+  _matrix[14] = _position[2];
+  _matrix[15] = 1.0f;
+}
+
+void
+hnd_transform_vector
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  kernels->transform_points(_matrix, (hnd_vector_t *)_source, (hnd_vector_t *)_destination, 1);
+}
+
+void
+hnd_transform_points
+(
+  hnd_matrix_t  _matrix,
+  hnd_vector_t *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+)
+{
+  kernels->transform_points(_matrix, _source, _destination, _count);
+}
+
+void
+hnd_identity_affine
+(
+  hnd_affine_t _affine
+)
+{
+  _affine[0] = 1.0f;
+  _affine[1] = 0.0f;
+  _affine[2] = 0.0f;
+  _affine[3] = 1.0f;
+  _affine[4] = 0.0f;
+  _affine[5] = 0.0f;
+}
+
+void
+hnd_compose_affine
+(
+  hnd_affine_t _affine,
+  hnd_vec2_t   _position,
+  float        _angle,
+  hnd_vec2_t   _scale
+)
+{
+  float sine = sinf(_angle);
+  float cosine = cosf(_angle);
+
+  _affine[0] = cosine * _scale[0];
+  _affine[1] = sine * _scale[0];
+  _affine[2] = -sine * _scale[1];
+  _affine[3] = cosine * _scale[1];
+  _affine[4] = _position[0];
+  _affine[5] = _position[1];
+}
+
+void
+hnd_multiply_affine
+(
+  hnd_affine_t _result,
+  hnd_affine_t _left,
+  hnd_affine_t _right
+)
+{
+  hnd_affine_t result =
+  {
+    _left[0] * _right[0] + _left[2] * _right[1],
+    _left[1] * _right[0] + _left[3] * _right[1],
+    _left[0] * _right[2] + _left[2] * _right[3],
+    _left[1] * _right[2] + _left[3] * _right[3],
+    _left[0] * _right[4] + _left[2] * _right[5] + _left[4],
+    _left[1] * _right[4] + _left[3] * _right[5] + _left[5]
+  };
+
+  memcpy(_result, result, sizeof(hnd_affine_t));
+}
+
+int
+hnd_invert_affine
+(
+  hnd_affine_t _result,
+  hnd_affine_t _affine
+)
+{
+  float determinant = _affine[0] * _affine[3] - _affine[1] * _affine[2];
+  if (determinant == 0.0f)
+    return HND_NK;
+
+  float inverse_determinant = 1.0f / determinant;
+  hnd_affine_t inverse =
+  {
+    _affine[3] * inverse_determinant,
+    -_affine[1] * inverse_determinant,
+    -_affine[2] * inverse_determinant,
+    _affine[0] * inverse_determinant
+  };
+  inverse[4] = -(inverse[0] * _affine[4] + inverse[2] * _affine[5]);
+  inverse[5] = -(inverse[1] * _affine[4] + inverse[3] * _affine[5]);
+
+  memcpy(_result, inverse, sizeof(hnd_affine_t));
+
+  return HND_OK;
+}
+
+void
+hnd_affine_to_matrix
+(
+  hnd_affine_t _affine,
+  hnd_matrix_t _matrix
+)
+{
+  hnd_identity_matrix(_matrix);
+
+  _matrix[0] = _affine[0];
+  _matrix[1] = _affine[1];
+  _matrix[4] = _affine[2];
+  _matrix[5] = _affine[3];
+  _matrix[12] = _affine[4];
+  _matrix[13] = _affine[5];
+}
+
+void
+hnd_transform_affine_points
+(
+  hnd_affine_t  _affine,
+  hnd_vec2_t   *_source,
+  hnd_vec2_t   *_destination,
+  size_t        _count
+)
+{
+  kernels->transform_affine_points(_affine, _source, _destination, _count);
+}
+
+void
+hnd_print_matrix
+(
+  hnd_matrix_t _matrix
+)
+{
+  /* @note Printed the way it reads on paper, row by row */
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int column = 0; column < 4; ++column)
+      printf("%.2f ", _matrix[column * 4 + row]);
+    printf("\n");
+  }
+}
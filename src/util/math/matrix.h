@@ -0,0 +1,310 @@
+/**
+ * @file src/util/math/matrix.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Matrices are column major, like OpenGL expects them: element (row, column) is
+ * stored at [column * 4 + row], and vectors are multiplied on the right.
+ *
+ * @note hnd_affine_t is the 2d fast path, a 2x3 matrix holding only the linear part and the
+ * translation: [a b c d x y] maps (px, py) to (a * px + c * py + x, b * px + d * py + y).
+ */
+
+#ifndef __HND_MATRIX_H__
+#define __HND_MATRIX_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include "vector.h"
+#include "compact_vector.h"
+
+typedef float hnd_matrix_t[16];
+typedef float hnd_affine_t[6];
+
+/**
+ * @brief Selects the kernels used by the matrix functions.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_matrix_kernels
+(
+  unsigned int _features
+);
+
+void
+hnd_identity_matrix
+(
+  hnd_matrix_t _matrix
+);
+
+void
+hnd_copy_matrix
+(
+  hnd_matrix_t _source,
+  hnd_matrix_t _destination
+);
+
+/**
+ * @brief _result = _left * _right, so _right is applied first.
+ *
+ * @note _result may be either of the operands.
+ *
+ * @param _result Specifies where to store the product.
+ * @param _left   Specifies the left operand.
+ * @param _right  Specifies the right operand.
+ */
+void
+hnd_multiply_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _left,
+  hnd_matrix_t _right
+);
+
+/**
+ * @brief Inverts a matrix.
+ *
+ * @note For matrices built from translations, rotations and scales,
+ * hnd_invert_affine_matrix is cheaper.
+ *
+ * @param _result Specifies where to store the inverse. May be _matrix.
+ * @param _matrix Specifies the matrix to invert.
+ *
+ * @return Function state. HND_NK if the matrix is singular, in which case _result is untouched.
+ */
+int
+hnd_invert_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _matrix
+);
+
+/**
+ * @brief Inverts a matrix whose last row is (0, 0, 0, 1).
+ *
+ * @param _result Specifies where to store the inverse. May be _matrix.
+ * @param _matrix Specifies the matrix to invert.
+ *
+ * @return Function state. HND_NK if the matrix is singular, in which case _result is untouched.
+ */
+int
+hnd_invert_affine_matrix
+(
+  hnd_matrix_t _result,
+  hnd_matrix_t _matrix
+);
+
+/**
+ * @brief Builds an orthographic projection, mapping the given box to OpenGL's clip space.
+ */
+void
+hnd_orthographic_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _left,
+  float        _right,
+  float        _bottom,
+  float        _top,
+  float        _near,
+  float        _far
+);
+
+/**
+ * @brief Builds a perspective projection, looking down -z.
+ *
+ * @param _matrix       Specifies where to store the projection.
+ * @param _fov          Specifies the vertical field of view, in radians.
+ * @param _aspect_ratio Specifies the width divided by the height of the viewport.
+ * @param _near         Specifies the distance to the near plane.
+ * @param _far          Specifies the distance to the far plane.
+ */
+void
+hnd_perspective_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _fov,
+  float        _aspect_ratio,
+  float        _near,
+  float        _far
+);
+
+void
+hnd_translation_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _translation
+);
+
+void
+hnd_scale_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _scale
+);
+
+/**
+ * @brief Builds a rotation around the z axis, the only one 2d needs.
+ *
+ * @param _matrix Specifies where to store the rotation.
+ * @param _angle  Specifies the counter clockwise angle, in radians.
+ */
+void
+hnd_rotation_z_matrix
+(
+  hnd_matrix_t _matrix,
+  float        _angle
+);
+
+/**
+ * @brief Builds a transformation, scaling first, then rotating, then translating.
+ *
+ * @param _matrix   Specifies where to store the transformation.
+ * @param _position Specifies the translation. w is ignored.
+ * @param _rotation Specifies the rotation, as a unit quaternion (x, y, z, w).
+ * @param _scale    Specifies the scale. w is ignored.
+ */
+void
+hnd_compose_matrix
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _position,
+  hnd_vector_t _rotation,
+  hnd_vector_t _scale
+);
+
+/**
+ * @brief _destination = _matrix * _source.
+ *
+ * @note _destination may be _source.
+ */
+void
+hnd_transform_vector
+(
+  hnd_matrix_t _matrix,
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+);
+
+/**
+ * @brief Transforms a whole array of vectors by the same matrix.
+ *
+ * @param _matrix      Specifies the transformation.
+ * @param _source      Specifies the vectors to transform.
+ * @param _destination Specifies where to store the transformed vectors. May be _source.
+ * @param _count       Specifies how many vectors there are.
+ */
+void
+hnd_transform_points
+(
+  hnd_matrix_t  _matrix,
+  hnd_vector_t *_source,
+  hnd_vector_t *_destination,
+  size_t        _count
+);
+
+/* @note 2d affine fast path */
+void
+hnd_identity_affine
+(
+  hnd_affine_t _affine
+);
+
+/**
+ * @brief Builds a 2d transformation, scaling first, then rotating, then translating.
+ *
+ * @param _affine   Specifies where to store the transformation.
+ * @param _position Specifies the translation.
+ * @param _angle    Specifies the counter clockwise rotation, in radians.
+ * @param _scale    Specifies the scale.
+ */
+void
+hnd_compose_affine
+(
+  hnd_affine_t _affine,
+  hnd_vec2_t   _position,
+  float        _angle,
+  hnd_vec2_t   _scale
+);
+
+/**
+ * @brief _result = _left * _right, so _right is applied first.
+ *
+ * @note _result may be either of the operands.
+ */
+void
+hnd_multiply_affine
+(
+  hnd_affine_t _result,
+  hnd_affine_t _left,
+  hnd_affine_t _right
+);
+
+/**
+ * @brief Inverts a 2d transformation.
+ *
+ * @return Function state. HND_NK if the transformation is singular, in which case _result is untouched.
+ */
+int
+hnd_invert_affine
+(
+  hnd_affine_t _result,
+  hnd_affine_t _affine
+);
+
+/**
+ * @brief Expands a 2d transformation to a 4x4 matrix, leaving z untouched.
+ */
+void
+hnd_affine_to_matrix
+(
+  hnd_affine_t _affine,
+  hnd_matrix_t _matrix
+);
+
+/**
+ * @brief Transforms a whole array of 2d points by the same transformation.
+ *
+ * @param _affine      Specifies the transformation.
+ * @param _source      Specifies the points to transform.
+ * @param _destination Specifies where to store the transformed points. May be _source.
+ * @param _count       Specifies how many points there are.
+ */
+void
+hnd_transform_affine_points
+(
+  hnd_affine_t  _affine,
+  hnd_vec2_t   *_source,
+  hnd_vec2_t   *_destination,
+  size_t        _count
+);
+
+void
+hnd_print_matrix
+(
+  hnd_matrix_t _matrix
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_MATRIX_H__ */
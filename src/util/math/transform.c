@@ -0,0 +1,257 @@
+/**
+ * @file src/util/math/transform.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "transform.h"
+#include "../../core/debug.h"
+
+/**
+ * @brief Resizes every array of a tree.
+ *
+ * @param _tree     Specifies the tree to grow.
+ * @param _capacity Specifies the new capacity.
+ *
+ * @return Function state. HND_OK or HND_NK.
+ */
+static int
+hnd_grow_transform_tree
+(
+  hnd_transform_tree_t *_tree,
+  size_t                _capacity
+)
+{
+  /* @note Each array is only replaced once reallocated, so a failure leaves the tree usable */
+  void *temp;
+
+#define HND_GROW_TRANSFORM_ARRAY(_array)                                          \
+  temp = hnd_reallocate(&_tree->allocator,                                        \
+                        _tree->_array,                                            \
+                        _tree->capacity * sizeof(*_tree->_array),                 \
+                        _capacity * sizeof(*_tree->_array));                      \
+  if (!hnd_assert(temp != NULL, NULL))                                            \
+    return HND_NK;                                                                \
+  _tree->_array = temp;
+
+  HND_GROW_TRANSFORM_ARRAY(parents);
+  HND_GROW_TRANSFORM_ARRAY(positions);
+  HND_GROW_TRANSFORM_ARRAY(rotations);
+  HND_GROW_TRANSFORM_ARRAY(scales);
+  HND_GROW_TRANSFORM_ARRAY(dirty);
+  HND_GROW_TRANSFORM_ARRAY(local_matrices);
+  HND_GROW_TRANSFORM_ARRAY(world_matrices);
+  HND_GROW_TRANSFORM_ARRAY(world_updates);
+
+#undef HND_GROW_TRANSFORM_ARRAY
+
+  _tree->capacity = _capacity;
+
+  return HND_OK;
+}
+
+hnd_transform_tree_t *
+hnd_create_transform_tree
+(
+  size_t           _capacity,
+  hnd_allocator_t *_allocator
+)
+{
+  hnd_transform_tree_t *new_tree = hnd_allocate(_allocator, sizeof(hnd_transform_tree_t));
+  if (!hnd_assert(new_tree != NULL, NULL))
+    return NULL;
+
+  memset(new_tree, 0x00, sizeof(hnd_transform_tree_t));
+  new_tree->allocator = _allocator ? *_allocator : hnd_get_tagged_allocator(HND_MEMORY_TAG_MATH);
+
+  if (_capacity == 0)
+    _capacity = 1;
+
+  if (!hnd_grow_transform_tree(new_tree, _capacity))
+  {
+    hnd_destroy_transform_tree(new_tree);
+
+    return NULL;
+  }
+
+  return new_tree;
+}
+
+void
+hnd_destroy_transform_tree
+(
+  hnd_transform_tree_t *_tree
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return;
+
+  hnd_allocator_t allocator = _tree->allocator;
+  size_t capacity = _tree->capacity;
+
+  hnd_deallocate(&allocator, _tree->parents, capacity * sizeof(int32_t));
+  hnd_deallocate(&allocator, _tree->positions, capacity * sizeof(hnd_vector_t));
+  hnd_deallocate(&allocator, _tree->rotations, capacity * sizeof(hnd_vector_t));
+  hnd_deallocate(&allocator, _tree->scales, capacity * sizeof(hnd_vector_t));
+  hnd_deallocate(&allocator, _tree->dirty, capacity * sizeof(uint8_t));
+  hnd_deallocate(&allocator, _tree->local_matrices, capacity * sizeof(hnd_matrix_t));
+  hnd_deallocate(&allocator, _tree->world_matrices, capacity * sizeof(hnd_matrix_t));
+  hnd_deallocate(&allocator, _tree->world_updates, capacity * sizeof(uint32_t));
+  hnd_deallocate(&allocator, _tree, sizeof(hnd_transform_tree_t));
+}
+
+/**
+ * @brief Flags a node so the next update recomputes it.
+ */
+static void
+hnd_mark_transform_dirty
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node
+)
+{
+  _tree->dirty[_node] = HND_OK;
+  if ((size_t)_node < _tree->first_dirty)
+    _tree->first_dirty = (size_t)_node;
+}
+
+int32_t
+hnd_add_transform
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _parent
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return -1;
+  if (!hnd_assert(_parent >= HND_TRANSFORM_ROOT && _parent < (int32_t)_tree->count, HND_SYNTAX))
+    return -1;
+
+  if (_tree->count == _tree->capacity && !hnd_grow_transform_tree(_tree, _tree->capacity * 2))
+    return -1;
+
+  int32_t node = (int32_t)_tree->count++;
+  _tree->parents[node] = _parent;
+  hnd_copy_vector((hnd_vector_t){ 0.0f, 0.0f, 0.0f, 0.0f }, _tree->positions[node]);
+  hnd_copy_vector((hnd_vector_t){ 0.0f, 0.0f, 0.0f, 1.0f }, _tree->rotations[node]);
+  hnd_copy_vector((hnd_vector_t){ 1.0f, 1.0f, 1.0f, 1.0f }, _tree->scales[node]);
+  _tree->world_updates[node] = 0;
+  hnd_mark_transform_dirty(_tree, node);
+
+  return node;
+}
+
+void
+hnd_set_transform_position
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _position
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return;
+  if (!hnd_assert(_node >= 0 && _node < (int32_t)_tree->count, HND_SYNTAX))
+    return;
+
+  hnd_copy_vector(_position, _tree->positions[_node]);
+  hnd_mark_transform_dirty(_tree, _node);
+}
+
+void
+hnd_set_transform_rotation
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _rotation
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return;
+  if (!hnd_assert(_node >= 0 && _node < (int32_t)_tree->count, HND_SYNTAX))
+    return;
+
+  hnd_copy_vector(_rotation, _tree->rotations[_node]);
+  hnd_mark_transform_dirty(_tree, _node);
+}
+
+void
+hnd_set_transform_scale
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _scale
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return;
+  if (!hnd_assert(_node >= 0 && _node < (int32_t)_tree->count, HND_SYNTAX))
+    return;
+
+  hnd_copy_vector(_scale, _tree->scales[_node]);
+  hnd_mark_transform_dirty(_tree, _node);
+}
+
+void
+hnd_update_transform_tree
+(
+  hnd_transform_tree_t *_tree
+)
+{
+  if (!hnd_assert(_tree != NULL, HND_SYNTAX))
+    return;
+
+  /* @note 0 means never updated, so skip it when wrapping around */
+  if (++_tree->update_count == 0)
+  {
+    memset(_tree->world_updates, 0x00, _tree->count * sizeof(uint32_t));
+    _tree->update_count = 1;
+  }
+
+  uint32_t update = _tree->update_count;
+  for (size_t i = _tree->first_dirty; i < _tree->count; ++i)
+  {
+    int32_t parent = _tree->parents[i];
+    int parent_changed = parent != HND_TRANSFORM_ROOT && _tree->world_updates[parent] == update;
+
+    if (!_tree->dirty[i] && !parent_changed)
+      continue;
+
+    if (_tree->dirty[i])
+    {
+      hnd_compose_matrix(_tree->local_matrices[i], _tree->positions[i], _tree->rotations[i], _tree->scales[i]);
+      _tree->dirty[i] = HND_NK;
+    }
+
+    if (parent == HND_TRANSFORM_ROOT)
+      hnd_copy_matrix(_tree->local_matrices[i], _tree->world_matrices[i]);
+    else
+      hnd_multiply_matrix(_tree->world_matrices[i], _tree->world_matrices[parent], _tree->local_matrices[i]);
+
+    _tree->world_updates[i] = update;
+  }
+
+  _tree->first_dirty = _tree->count;
+}
+
+int
+hnd_transform_changed
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node
+)
+{
+  return _tree->world_updates[_node] == _tree->update_count;
+}
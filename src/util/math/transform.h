@@ -0,0 +1,183 @@
+/**
+ * @file src/util/math/transform.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Parent/child transformations stored as a flat structure of arrays. Nodes can only
+ * be added after their parent, so parents always come first and world matrices can be
+ * updated in a single linear pass, without recursion.
+ *
+ * @note Only nodes whose local transformation changed, and their descendants, get their
+ * matrices recomputed. The pass also starts at the first dirty node, since nothing before
+ * it can be affected.
+ */
+
+#ifndef __HND_TRANSFORM_H__
+#define __HND_TRANSFORM_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "vector.h"
+#include "matrix.h"
+#include "../../core/memory/memory.h"
+
+#define HND_TRANSFORM_ROOT -1
+
+/**
+ * @brief Transform hierarchy data.
+ */
+typedef struct hnd_transform_tree_t
+{
+  size_t count;
+  size_t capacity;
+
+  /* @note Index of the first node whose local transformation changed since the last update */
+  size_t first_dirty;
+  uint32_t update_count;
+
+  int32_t *parents;
+  hnd_vector_t *positions;
+  hnd_vector_t *rotations;
+  hnd_vector_t *scales;
+  uint8_t *dirty;
+
+  hnd_matrix_t *local_matrices;
+  hnd_matrix_t *world_matrices;
+  /* @note The update_count of the last update that changed each world matrix */
+  uint32_t *world_updates;
+
+  hnd_allocator_t allocator;
+} hnd_transform_tree_t;
+
+/**
+ * @brief Creates a transform hierarchy.
+ *
+ * @param _capacity  Specifies how many nodes to make room for. The tree grows when needed.
+ * @param _allocator Specifies where the tree's memory comes from. NULL for the heap.
+ *
+ * @return The created tree.
+ */
+hnd_transform_tree_t *
+hnd_create_transform_tree
+(
+  size_t           _capacity,
+  hnd_allocator_t *_allocator
+);
+
+/**
+ * @brief Ends a transform hierarchy.
+ *
+ * @param _tree Specifies the tree to destroy.
+ */
+void
+hnd_destroy_transform_tree
+(
+  hnd_transform_tree_t *_tree
+);
+
+/**
+ * @brief Adds an identity node to a tree.
+ *
+ * @param _tree   Specifies the tree where the node should be added.
+ * @param _parent Specifies the index of the parent node, or HND_TRANSFORM_ROOT.
+ *
+ * @return The new node index, or -1 on failure.
+ */
+int32_t
+hnd_add_transform
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _parent
+);
+
+void
+hnd_set_transform_position
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _position
+);
+
+/**
+ * @brief Sets a node's rotation.
+ *
+ * @param _tree     Specifies the tree where the node is.
+ * @param _node     Specifies the node index.
+ * @param _rotation Specifies the rotation, as a unit quaternion (x, y, z, w).
+ */
+void
+hnd_set_transform_rotation
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _rotation
+);
+
+void
+hnd_set_transform_scale
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node,
+  hnd_vector_t          _scale
+);
+
+/**
+ * @brief Recomputes the world matrices of every dirty node and its descendants.
+ *
+ * @param _tree Specifies the tree to update.
+ */
+void
+hnd_update_transform_tree
+(
+  hnd_transform_tree_t *_tree
+);
+
+/**
+ * @brief Checks whether a node's world matrix changed on the last update.
+ *
+ * @note Useful to only upload what moved to the GPU.
+ *
+ * @return HND_OK if it changed, HND_NK otherwise.
+ */
+int
+hnd_transform_changed
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node
+);
+
+/**
+ * @brief Gets a node's world matrix, as of the last update.
+ */
+static inline float *
+hnd_get_world_matrix
+(
+  hnd_transform_tree_t *_tree,
+  int32_t               _node
+)
+{
+  return _tree->world_matrices[_node];
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_TRANSFORM_H__ */
@@ -17,9 +17,29 @@
  */
 
 #include "vector.h"
+#include "../../core/cpu.h"
+#include <math.h>
 
-void
-hnd_copy_vector
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_VECTOR_X86
+#endif /* __x86_64__ || __i386__ */
+
+/**
+ * @brief Set of kernels backing the public vector operations.
+ */
+typedef struct hnd_vector_kernels_t
+{
+  void (*copy)(hnd_vector_t, hnd_vector_t);
+  void (*add)(hnd_vector_t, hnd_vector_t);
+  void (*subtract)(hnd_vector_t, hnd_vector_t);
+  void (*multiply)(hnd_vector_t, hnd_vector_t);
+  void (*divide)(hnd_vector_t, hnd_vector_t);
+} hnd_vector_kernels_t;
+
+/* @note Scalar fallback */
+static void
+hnd_copy_vector_scalar
 (
   hnd_vector_t _source,
   hnd_vector_t _destination
@@ -29,8 +49,8 @@ hnd_copy_vector
     _destination[i] = _source[i];
 }
 
-void
-hnd_add_vector
+static void
+hnd_add_vector_scalar
 (
   hnd_vector_t _left,
   hnd_vector_t _right
@@ -40,8 +60,8 @@ hnd_add_vector
     _left[i] += _right[i];
 }
 
-void
-hnd_subtract_vector
+static void
+hnd_subtract_vector_scalar
 (
   hnd_vector_t _left,
   hnd_vector_t _right
@@ -51,8 +71,8 @@ hnd_subtract_vector
     _left[i] -= _right[i];
 }
 
-void
-hnd_multiply_vector
+static void
+hnd_multiply_vector_scalar
 (
   hnd_vector_t _left,
   hnd_vector_t _right
@@ -62,8 +82,8 @@ hnd_multiply_vector
     _left[i] *= _right[i];
 }
 
-void
-hnd_divide_vector
+static void
+hnd_divide_vector_scalar
 (
   hnd_vector_t _left,
   hnd_vector_t _right
@@ -73,6 +93,252 @@ hnd_divide_vector
     _left[i] /= _right[i];
 }
 
+static const hnd_vector_kernels_t scalar_kernels =
+{
+  hnd_copy_vector_scalar,
+  hnd_add_vector_scalar,
+  hnd_subtract_vector_scalar,
+  hnd_multiply_vector_scalar,
+  hnd_divide_vector_scalar
+};
+
+#ifdef HND_VECTOR_X86
+/* @note SSE kernels. Vectors aren't guaranteed to be 16 byte aligned, hence the unaligned loads. */
+__attribute__((target("sse"))) static void
+hnd_copy_vector_sse
+(
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  _mm_storeu_ps(_destination, _mm_loadu_ps(_source));
+}
+
+__attribute__((target("sse"))) static void
+hnd_add_vector_sse
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_add_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("sse"))) static void
+hnd_subtract_vector_sse
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_sub_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("sse"))) static void
+hnd_multiply_vector_sse
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_mul_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("sse"))) static void
+hnd_divide_vector_sse
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_div_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+static const hnd_vector_kernels_t sse_kernels =
+{
+  hnd_copy_vector_sse,
+  hnd_add_vector_sse,
+  hnd_subtract_vector_sse,
+  hnd_multiply_vector_sse,
+  hnd_divide_vector_sse
+};
+
+/* @note AVX kernels. Same 128-bit operations, but VEX encoded, so callers running AVX code
+ * don't pay the SSE/AVX transition penalty.
+ */
+__attribute__((target("avx"))) static void
+hnd_copy_vector_avx
+(
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  _mm_storeu_ps(_destination, _mm_loadu_ps(_source));
+}
+
+__attribute__((target("avx"))) static void
+hnd_add_vector_avx
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_add_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("avx"))) static void
+hnd_subtract_vector_avx
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_sub_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("avx"))) static void
+hnd_multiply_vector_avx
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_mul_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+__attribute__((target("avx"))) static void
+hnd_divide_vector_avx
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_div_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+static const hnd_vector_kernels_t avx_kernels =
+{
+  hnd_copy_vector_avx,
+  hnd_add_vector_avx,
+  hnd_subtract_vector_avx,
+  hnd_multiply_vector_avx,
+  hnd_divide_vector_avx
+};
+#endif /* HND_VECTOR_X86 */
+
+static const hnd_vector_kernels_t *kernels = &scalar_kernels;
+
+void
+hnd_select_vector_kernels
+(
+  unsigned int _features
+)
+{
+  kernels = &scalar_kernels;
+
+#ifdef HND_VECTOR_X86
+  if (_features & HND_CPU_AVX)
+    kernels = &avx_kernels;
+  else if (_features & HND_CPU_SSE)
+    kernels = &sse_kernels;
+#endif /* HND_VECTOR_X86 */
+}
+
+/**
+ * @brief Picks the best kernels before main runs, so the hot path is a single indirect call.
+ */
+__attribute__((constructor)) static void
+hnd_init_vector_kernels
+(
+  void
+)
+{
+  hnd_select_vector_kernels(hnd_get_cpu_features());
+}
+
+void
+hnd_copy_vector
+(
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  kernels->copy(_source, _destination);
+}
+
+void
+hnd_add_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  kernels->add(_left, _right);
+}
+
+void
+hnd_subtract_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  kernels->subtract(_left, _right);
+}
+
+void
+hnd_multiply_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  kernels->multiply(_left, _right);
+}
+
+void
+hnd_divide_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  kernels->divide(_left, _right);
+}
+
+float
+hnd_dot_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  return _left[0] * _right[0] + _left[1] * _right[1] + _left[2] * _right[2];
+}
+
+float
+hnd_length_vector
+(
+  hnd_vector_t _vector
+)
+{
+  return sqrtf(hnd_dot_vector(_vector, _vector));
+}
+
+void
+hnd_normalize_vector
+(
+  hnd_vector_t _vector
+)
+{
+  float length = hnd_length_vector(_vector);
+  if (length == 0.0f)
+    return;
+
+  for (int i = 0; i < 3; ++i)
+    _vector[i] /= length;
+}
+
 void
 hnd_print_vector
 (
@@ -16,7 +16,13 @@
  * GNU General Public License for more details.
  *
  * @note Every vector is a 4d vector. I could use a union, but it would just create the same
- * amount of memory (the biggest, in this case, a 4d vector).
+ * amount of memory (the biggest, in this case, a 4d vector). For bulk data that only needs
+ * 2 or 3 components, see compact_vector.h.
+ *
+ * @note A 4d float vector is exactly one 128-bit SIMD lane, so the operations below are
+ * implemented with SSE/AVX kernels, chosen once at startup based on what the CPU supports.
+ * The hnd_*_vector_inline variants do the same at compile time and can be folded into the
+ * caller, prefer them on hot loops.
  */
 
 #ifndef __HND_VECTOR_H__
@@ -28,9 +34,26 @@ extern "C"
 #endif /* __cplusplus */
 
 #include <stdio.h>
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif /* __SSE__ */
 
 typedef float hnd_vector_t[4];
 
+/**
+ * @brief Selects the vector kernels used by the hnd_*_vector functions.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features(). Calling it again is
+ * only needed to force a specific path, e.g. passing 0 to benchmark the scalar fallback.
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_vector_kernels
+(
+  unsigned int _features
+);
+
 void
 hnd_copy_vector
 (
@@ -66,12 +89,160 @@ hnd_divide_vector
   hnd_vector_t _right
 );
 
+/**
+ * @brief Dot product of the x, y and z components.
+ *
+ * @note w is ignored, so points (w = 1) and directions (w = 0) can be mixed. See approx.h
+ * for the faster, approximate length and normalize.
+ */
+float
+hnd_dot_vector
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+);
+
+float
+hnd_length_vector
+(
+  hnd_vector_t _vector
+);
+
+/**
+ * @brief Scales x, y and z to unit length, leaving w untouched.
+ *
+ * @note Zero length vectors are left as they are.
+ */
+void
+hnd_normalize_vector
+(
+  hnd_vector_t _vector
+);
+
 void
 hnd_print_vector
 (
   hnd_vector_t _vector
 );
 
+/* @note Inline variants */
+#if defined(__SSE__)
+static inline void
+hnd_copy_vector_inline
+(
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  _mm_storeu_ps(_destination, _mm_loadu_ps(_source));
+}
+
+static inline void
+hnd_add_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_add_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+static inline void
+hnd_subtract_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_sub_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+static inline void
+hnd_multiply_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_mul_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+
+static inline void
+hnd_divide_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _mm_storeu_ps(_left, _mm_div_ps(_mm_loadu_ps(_left), _mm_loadu_ps(_right)));
+}
+#else
+static inline void
+hnd_copy_vector_inline
+(
+  hnd_vector_t _source,
+  hnd_vector_t _destination
+)
+{
+  _destination[0] = _source[0];
+  _destination[1] = _source[1];
+  _destination[2] = _source[2];
+  _destination[3] = _source[3];
+}
+
+static inline void
+hnd_add_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _left[0] += _right[0];
+  _left[1] += _right[1];
+  _left[2] += _right[2];
+  _left[3] += _right[3];
+}
+
+static inline void
+hnd_subtract_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _left[0] -= _right[0];
+  _left[1] -= _right[1];
+  _left[2] -= _right[2];
+  _left[3] -= _right[3];
+}
+
+static inline void
+hnd_multiply_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _left[0] *= _right[0];
+  _left[1] *= _right[1];
+  _left[2] *= _right[2];
+  _left[3] *= _right[3];
+}
+
+static inline void
+hnd_divide_vector_inline
+(
+  hnd_vector_t _left,
+  hnd_vector_t _right
+)
+{
+  _left[0] /= _right[0];
+  _left[1] /= _right[1];
+  _left[2] /= _right[2];
+  _left[3] /= _right[3];
+}
+#endif /* __SSE__ */
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,636 @@
+/**
+ * @file src/util/math/vector_array.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "vector_array.h"
+#include "../../core/cpu.h"
+#include "../../core/thread/thread.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HND_VECTOR_ARRAY_X86
+#endif /* __x86_64__ || __i386__ */
+
+/* Stream operations */
+#define HND_VECTOR_STREAM_ADD          0
+#define HND_VECTOR_STREAM_MULTIPLY_ADD 1
+#define HND_VECTOR_STREAM_SCALE        2
+#define HND_VECTOR_STREAM_LERP         3
+#define HND_VECTOR_STREAM_CLAMP        4
+
+/**
+ * @brief Kernels working on flat float streams.
+ *
+ * @note Every parameter is a 4 float pattern, where element i of the stream uses
+ * parameter[i & 3]. That lets the same kernels run over array of structures data, where
+ * each component has its own parameter, and over structure of arrays data, where the
+ * pattern is a single value broadcasted. Streams handed to kernels always start at a
+ * multiple of 4, so the pattern phase is preserved.
+ */
+typedef struct hnd_vector_array_kernels_t
+{
+  void (*add)(float *, const float *, size_t);
+  void (*multiply_add)(float *, const float *, const float *, size_t);
+  void (*scale)(float *, const float *, size_t);
+  void (*lerp)(float *, const float *, const float *, const float *, size_t);
+  void (*clamp)(float *, const float *, const float *, size_t);
+} hnd_vector_array_kernels_t;
+
+/**
+ * @brief A pending stream operation, so it can be handed to the worker threads.
+ */
+typedef struct hnd_vector_stream_t
+{
+  unsigned int operation;
+  float *destination;
+  const float *sources[2];
+  float parameters[2][4];
+} hnd_vector_stream_t;
+
+/* @note Scalar fallback, also used for the tails of the SIMD kernels */
+static void
+hnd_add_stream_scalar
+(
+  float       *_destination,
+  const float *_source,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _destination[i] += _source[i];
+}
+
+static void
+hnd_multiply_add_stream_scalar
+(
+  float       *_destination,
+  const float *_source,
+  const float *_scale,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _destination[i] += _source[i] * _scale[i & 3];
+}
+
+static void
+hnd_scale_stream_scalar
+(
+  float       *_destination,
+  const float *_scale,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _destination[i] *= _scale[i & 3];
+}
+
+static void
+hnd_lerp_stream_scalar
+(
+  float       *_destination,
+  const float *_from,
+  const float *_to,
+  const float *_amount,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+    _destination[i] = _from[i] + (_to[i] - _from[i]) * _amount[i & 3];
+}
+
+static void
+hnd_clamp_stream_scalar
+(
+  float       *_destination,
+  const float *_minimum,
+  const float *_maximum,
+  size_t       _count
+)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    float value = _destination[i] > _minimum[i & 3] ? _destination[i] : _minimum[i & 3];
+    _destination[i] = value < _maximum[i & 3] ? value : _maximum[i & 3];
+  }
+}
+
+static const hnd_vector_array_kernels_t scalar_kernels =
+{
+  hnd_add_stream_scalar,
+  hnd_multiply_add_stream_scalar,
+  hnd_scale_stream_scalar,
+  hnd_lerp_stream_scalar,
+  hnd_clamp_stream_scalar
+};
+
+#ifdef HND_VECTOR_ARRAY_X86
+/* @note SSE kernels, 4 floats per iteration */
+__attribute__((target("sse"))) static void
+hnd_add_stream_sse
+(
+  float       *_destination,
+  const float *_source,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+    _mm_storeu_ps(_destination + i, _mm_add_ps(_mm_loadu_ps(_destination + i), _mm_loadu_ps(_source + i)));
+
+  hnd_add_stream_scalar(_destination + i, _source + i, _count - i);
+}
+
+__attribute__((target("sse"))) static void
+hnd_multiply_add_stream_sse
+(
+  float       *_destination,
+  const float *_source,
+  const float *_scale,
+  size_t       _count
+)
+{
+  __m128 scale = _mm_loadu_ps(_scale);
+
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+    _mm_storeu_ps(_destination + i,
+                  _mm_add_ps(_mm_loadu_ps(_destination + i), _mm_mul_ps(_mm_loadu_ps(_source + i), scale)));
+
+  hnd_multiply_add_stream_scalar(_destination + i, _source + i, _scale, _count - i);
+}
+
+__attribute__((target("sse"))) static void
+hnd_scale_stream_sse
+(
+  float       *_destination,
+  const float *_scale,
+  size_t       _count
+)
+{
+  __m128 scale = _mm_loadu_ps(_scale);
+
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+    _mm_storeu_ps(_destination + i, _mm_mul_ps(_mm_loadu_ps(_destination + i), scale));
+
+  hnd_scale_stream_scalar(_destination + i, _scale, _count - i);
+}
+
+__attribute__((target("sse"))) static void
+hnd_lerp_stream_sse
+(
+  float       *_destination,
+  const float *_from,
+  const float *_to,
+  const float *_amount,
+  size_t       _count
+)
+{
+  __m128 amount = _mm_loadu_ps(_amount);
+
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 from = _mm_loadu_ps(_from + i);
+    __m128 to = _mm_loadu_ps(_to + i);
+    _mm_storeu_ps(_destination + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), amount)));
+  }
+
+  hnd_lerp_stream_scalar(_destination + i, _from + i, _to + i, _amount, _count - i);
+}
+
+__attribute__((target("sse"))) static void
+hnd_clamp_stream_sse
+(
+  float       *_destination,
+  const float *_minimum,
+  const float *_maximum,
+  size_t       _count
+)
+{
+  __m128 minimum = _mm_loadu_ps(_minimum);
+  __m128 maximum = _mm_loadu_ps(_maximum);
+
+  size_t i = 0;
+  for (; i + 4 <= _count; i += 4)
+    _mm_storeu_ps(_destination + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(_destination + i), minimum), maximum));
+
+  hnd_clamp_stream_scalar(_destination + i, _minimum, _maximum, _count - i);
+}
+
+static const hnd_vector_array_kernels_t sse_kernels =
+{
+  hnd_add_stream_sse,
+  hnd_multiply_add_stream_sse,
+  hnd_scale_stream_sse,
+  hnd_lerp_stream_sse,
+  hnd_clamp_stream_sse
+};
+
+/* @note AVX2 kernels, 8 floats per iteration, with fused multiply-adds.
+ *
+ * @note _mm256_broadcast_ps repeats the 4 float pattern on both lanes, which is fine since
+ * the loops always advance by 8.
+ */
+__attribute__((target("avx2,fma"))) static void
+hnd_add_stream_avx2
+(
+  float       *_destination,
+  const float *_source,
+  size_t       _count
+)
+{
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+    _mm256_storeu_ps(_destination + i,
+                     _mm256_add_ps(_mm256_loadu_ps(_destination + i), _mm256_loadu_ps(_source + i)));
+
+  hnd_add_stream_scalar(_destination + i, _source + i, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_multiply_add_stream_avx2
+(
+  float       *_destination,
+  const float *_source,
+  const float *_scale,
+  size_t       _count
+)
+{
+  __m256 scale = _mm256_broadcast_ps((const __m128 *)_scale);
+
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+    _mm256_storeu_ps(_destination + i,
+                     _mm256_fmadd_ps(_mm256_loadu_ps(_source + i), scale, _mm256_loadu_ps(_destination + i)));
+
+  hnd_multiply_add_stream_scalar(_destination + i, _source + i, _scale, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_scale_stream_avx2
+(
+  float       *_destination,
+  const float *_scale,
+  size_t       _count
+)
+{
+  __m256 scale = _mm256_broadcast_ps((const __m128 *)_scale);
+
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+    _mm256_storeu_ps(_destination + i, _mm256_mul_ps(_mm256_loadu_ps(_destination + i), scale));
+
+  hnd_scale_stream_scalar(_destination + i, _scale, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_lerp_stream_avx2
+(
+  float       *_destination,
+  const float *_from,
+  const float *_to,
+  const float *_amount,
+  size_t       _count
+)
+{
+  __m256 amount = _mm256_broadcast_ps((const __m128 *)_amount);
+
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m256 from = _mm256_loadu_ps(_from + i);
+    __m256 to = _mm256_loadu_ps(_to + i);
+    _mm256_storeu_ps(_destination + i, _mm256_fmadd_ps(_mm256_sub_ps(to, from), amount, from));
+  }
+
+  hnd_lerp_stream_scalar(_destination + i, _from + i, _to + i, _amount, _count - i);
+}
+
+__attribute__((target("avx2,fma"))) static void
+hnd_clamp_stream_avx2
+(
+  float       *_destination,
+  const float *_minimum,
+  const float *_maximum,
+  size_t       _count
+)
+{
+  __m256 minimum = _mm256_broadcast_ps((const __m128 *)_minimum);
+  __m256 maximum = _mm256_broadcast_ps((const __m128 *)_maximum);
+
+  size_t i = 0;
+  for (; i + 8 <= _count; i += 8)
+    _mm256_storeu_ps(_destination + i,
+                     _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(_destination + i), minimum), maximum));
+
+  hnd_clamp_stream_scalar(_destination + i, _minimum, _maximum, _count - i);
+}
+
+static const hnd_vector_array_kernels_t avx2_kernels =
+{
+  hnd_add_stream_avx2,
+  hnd_multiply_add_stream_avx2,
+  hnd_scale_stream_avx2,
+  hnd_lerp_stream_avx2,
+  hnd_clamp_stream_avx2
+};
+#endif /* HND_VECTOR_ARRAY_X86 */
+
+static const hnd_vector_array_kernels_t *kernels = &scalar_kernels;
+
+void
+hnd_select_vector_array_kernels
+(
+  unsigned int _features
+)
+{
+  kernels = &scalar_kernels;
+
+#ifdef HND_VECTOR_ARRAY_X86
+  if ((_features & HND_CPU_AVX2) && (_features & HND_CPU_FMA))
+    kernels = &avx2_kernels;
+  else if (_features & HND_CPU_SSE)
+    kernels = &sse_kernels;
+#endif /* HND_VECTOR_ARRAY_X86 */
+}
+
+__attribute__((constructor)) static void
+hnd_init_vector_array_kernels
+(
+  void
+)
+{
+  hnd_select_vector_array_kernels(hnd_get_cpu_features());
+}
+
+static void
+hnd_run_vector_stream
+(
+  size_t  _begin,
+  size_t  _end,
+  void   *_stream
+)
+{
+  hnd_vector_stream_t *stream = (hnd_vector_stream_t *)_stream;
+  float *destination = stream->destination + _begin;
+  size_t count = _end - _begin;
+
+  switch (stream->operation)
+  {
+  case HND_VECTOR_STREAM_ADD:
+    kernels->add(destination, stream->sources[0] + _begin, count);
+
+    break;
+  case HND_VECTOR_STREAM_MULTIPLY_ADD:
+    kernels->multiply_add(destination, stream->sources[0] + _begin, stream->parameters[0], count);
+
+    break;
+  case HND_VECTOR_STREAM_SCALE:
+    kernels->scale(destination, stream->parameters[0], count);
+
+    break;
+  case HND_VECTOR_STREAM_LERP:
+    kernels->lerp(destination,
+                  stream->sources[0] + _begin,
+                  stream->sources[1] + _begin,
+                  stream->parameters[0],
+                  count);
+
+    break;
+  case HND_VECTOR_STREAM_CLAMP:
+    kernels->clamp(destination, stream->parameters[0], stream->parameters[1], count);
+
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Runs a stream operation, splitting it between threads when it's big enough.
+ *
+ * @param _stream Specifies the operation.
+ * @param _count  Specifies how many floats the stream has.
+ */
+static void
+hnd_process_vector_stream
+(
+  hnd_vector_stream_t *_stream,
+  size_t               _count
+)
+{
+  if (_count >= HND_VECTOR_ARRAY_PARALLEL_THRESHOLD)
+    hnd_parallel_for(_count, HND_VECTOR_ARRAY_PARALLEL_GRAIN, hnd_run_vector_stream, _stream);
+  else
+    hnd_run_vector_stream(0, _count, _stream);
+}
+
+/**
+ * @brief Runs a stream operation once per component of a structure of arrays.
+ *
+ * @param _stream      Specifies the operation, whose parameters hold one value per component.
+ * @param _destination Specifies the destination arrays.
+ * @param _sources     Specifies the source arrays, as many as the operation takes.
+ * @param _count       Specifies how many vectors there are.
+ */
+static void
+hnd_process_vector_soa
+(
+  hnd_vector_stream_t  *_stream,
+  hnd_vector_soa_t     *_destination,
+  hnd_vector_soa_t    **_sources,
+  size_t                _count
+)
+{
+  float *destination[4] = { _destination->x, _destination->y, _destination->z, _destination->w };
+  float parameters[2][4];
+  memcpy(parameters, _stream->parameters, sizeof(parameters));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    if (!destination[i])
+      continue;
+
+    hnd_vector_stream_t stream = *_stream;
+    stream.destination = destination[i];
+
+    for (int j = 0; j < 2; ++j)
+    {
+      if (!_sources[j])
+        continue;
+
+      float *source[4] = { _sources[j]->x, _sources[j]->y, _sources[j]->z, _sources[j]->w };
+      stream.sources[j] = source[i];
+    }
+
+    /* @note Broadcast this component's parameters */
+    for (int j = 0; j < 4; ++j)
+    {
+      stream.parameters[0][j] = parameters[0][i];
+      stream.parameters[1][j] = parameters[1][i];
+    }
+
+    hnd_process_vector_stream(&stream, _count);
+  }
+}
+
+void
+hnd_add_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t *_right,
+  size_t        _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_ADD, (float *)_left, { (float *)_right, NULL } };
+  hnd_process_vector_stream(&stream, _count * 4);
+}
+
+void
+hnd_multiply_add_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t *_right,
+  hnd_vector_t  _scale,
+  size_t        _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_MULTIPLY_ADD, (float *)_left, { (float *)_right, NULL } };
+  memcpy(stream.parameters[0], _scale, sizeof(hnd_vector_t));
+  hnd_process_vector_stream(&stream, _count * 4);
+}
+
+void
+hnd_scale_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t  _scale,
+  size_t        _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_SCALE, (float *)_left, { NULL, NULL } };
+  memcpy(stream.parameters[0], _scale, sizeof(hnd_vector_t));
+  hnd_process_vector_stream(&stream, _count * 4);
+}
+
+void
+hnd_lerp_vector_array
+(
+  hnd_vector_t *_result,
+  hnd_vector_t *_from,
+  hnd_vector_t *_to,
+  float         _amount,
+  size_t        _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_LERP, (float *)_result, { (float *)_from, (float *)_to } };
+  for (int i = 0; i < 4; ++i)
+    stream.parameters[0][i] = _amount;
+  hnd_process_vector_stream(&stream, _count * 4);
+}
+
+void
+hnd_clamp_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t  _minimum,
+  hnd_vector_t  _maximum,
+  size_t        _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_CLAMP, (float *)_left, { NULL, NULL } };
+  memcpy(stream.parameters[0], _minimum, sizeof(hnd_vector_t));
+  memcpy(stream.parameters[1], _maximum, sizeof(hnd_vector_t));
+  hnd_process_vector_stream(&stream, _count * 4);
+}
+
+void
+hnd_add_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_soa_t *_right,
+  size_t            _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_ADD };
+  hnd_vector_soa_t *sources[2] = { _right, NULL };
+  hnd_process_vector_soa(&stream, _left, sources, _count);
+}
+
+void
+hnd_multiply_add_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_soa_t *_right,
+  hnd_vector_t      _scale,
+  size_t            _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_MULTIPLY_ADD };
+  memcpy(stream.parameters[0], _scale, sizeof(hnd_vector_t));
+  hnd_vector_soa_t *sources[2] = { _right, NULL };
+  hnd_process_vector_soa(&stream, _left, sources, _count);
+}
+
+void
+hnd_scale_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_t      _scale,
+  size_t            _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_SCALE };
+  memcpy(stream.parameters[0], _scale, sizeof(hnd_vector_t));
+  hnd_vector_soa_t *sources[2] = { NULL, NULL };
+  hnd_process_vector_soa(&stream, _left, sources, _count);
+}
+
+void
+hnd_lerp_vector_soa
+(
+  hnd_vector_soa_t *_result,
+  hnd_vector_soa_t *_from,
+  hnd_vector_soa_t *_to,
+  float             _amount,
+  size_t            _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_LERP };
+  for (int i = 0; i < 4; ++i)
+    stream.parameters[0][i] = _amount;
+  hnd_vector_soa_t *sources[2] = { _from, _to };
+  hnd_process_vector_soa(&stream, _result, sources, _count);
+}
+
+void
+hnd_clamp_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_t      _minimum,
+  hnd_vector_t      _maximum,
+  size_t            _count
+)
+{
+  hnd_vector_stream_t stream = { HND_VECTOR_STREAM_CLAMP };
+  memcpy(stream.parameters[0], _minimum, sizeof(hnd_vector_t));
+  memcpy(stream.parameters[1], _maximum, sizeof(hnd_vector_t));
+  hnd_vector_soa_t *sources[2] = { NULL, NULL };
+  hnd_process_vector_soa(&stream, _left, sources, _count);
+}
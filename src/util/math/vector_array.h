@@ -0,0 +1,200 @@
+/**
+ * @file src/util/math/vector_array.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Stream operations over many vectors at once, so hot loops pay one call per batch
+ * instead of one per vector. Both array of structures (hnd_vector_t *) and structure of
+ * arrays (hnd_vector_soa_t) layouts are supported.
+ *
+ * @note Batches bigger than HND_VECTOR_ARRAY_PARALLEL_THRESHOLD floats are split between
+ * the worker threads of hnd_parallel_for.
+ */
+
+#ifndef __HND_VECTOR_ARRAY_H__
+#define __HND_VECTOR_ARRAY_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include "vector.h"
+
+/* @note Counted in floats, 1MB worth of data */
+#define HND_VECTOR_ARRAY_PARALLEL_THRESHOLD 262144
+#define HND_VECTOR_ARRAY_PARALLEL_GRAIN     16384
+
+/**
+ * @brief Structure of arrays vector layout.
+ *
+ * @note Components a layout doesn't use (e.g. z and w for 2d data) should be NULL, they
+ * are skipped by every operation. Sources must have every component the destination has.
+ */
+typedef struct hnd_vector_soa_t
+{
+  float *x;
+  float *y;
+  float *z;
+  float *w;
+} hnd_vector_soa_t;
+
+/**
+ * @brief Selects the kernels used by the array operations.
+ *
+ * @note Runs automatically at startup with hnd_get_cpu_features().
+ *
+ * @param _features Specifies a mask of HND_CPU_* flags the kernels are allowed to use.
+ */
+void
+hnd_select_vector_array_kernels
+(
+  unsigned int _features
+);
+
+/**
+ * @brief _left[i] += _right[i]
+ *
+ * @param _left  Specifies the vectors to change.
+ * @param _right Specifies the vectors to add.
+ * @param _count Specifies how many vectors there are.
+ */
+void
+hnd_add_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t *_right,
+  size_t        _count
+);
+
+/**
+ * @brief _left[i] += _right[i] * _scale, e.g. position += velocity * delta time.
+ *
+ * @param _left  Specifies the vectors to change.
+ * @param _right Specifies the vectors to scale and add.
+ * @param _scale Specifies the per component scale.
+ * @param _count Specifies how many vectors there are.
+ */
+void
+hnd_multiply_add_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t *_right,
+  hnd_vector_t  _scale,
+  size_t        _count
+);
+
+/**
+ * @brief _left[i] *= _scale
+ *
+ * @param _left  Specifies the vectors to change.
+ * @param _scale Specifies the per component scale.
+ * @param _count Specifies how many vectors there are.
+ */
+void
+hnd_scale_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t  _scale,
+  size_t        _count
+);
+
+/**
+ * @brief _result[i] = _from[i] + (_to[i] - _from[i]) * _amount
+ *
+ * @param _result Specifies where to store the interpolated vectors. May be _from or _to.
+ * @param _from   Specifies the vectors at _amount 0.
+ * @param _to     Specifies the vectors at _amount 1.
+ * @param _amount Specifies the interpolation amount.
+ * @param _count  Specifies how many vectors there are.
+ */
+void
+hnd_lerp_vector_array
+(
+  hnd_vector_t *_result,
+  hnd_vector_t *_from,
+  hnd_vector_t *_to,
+  float         _amount,
+  size_t        _count
+);
+
+/**
+ * @brief Clamps every component of _left[i] between _minimum and _maximum.
+ *
+ * @param _left    Specifies the vectors to change.
+ * @param _minimum Specifies the per component lower bound.
+ * @param _maximum Specifies the per component upper bound.
+ * @param _count   Specifies how many vectors there are.
+ */
+void
+hnd_clamp_vector_array
+(
+  hnd_vector_t *_left,
+  hnd_vector_t  _minimum,
+  hnd_vector_t  _maximum,
+  size_t        _count
+);
+
+/* @note Structure of arrays variants, same semantics as the ones above */
+void
+hnd_add_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_soa_t *_right,
+  size_t            _count
+);
+
+void
+hnd_multiply_add_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_soa_t *_right,
+  hnd_vector_t      _scale,
+  size_t            _count
+);
+
+void
+hnd_scale_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_t      _scale,
+  size_t            _count
+);
+
+void
+hnd_lerp_vector_soa
+(
+  hnd_vector_soa_t *_result,
+  hnd_vector_soa_t *_from,
+  hnd_vector_soa_t *_to,
+  float             _amount,
+  size_t            _count
+);
+
+void
+hnd_clamp_vector_soa
+(
+  hnd_vector_soa_t *_left,
+  hnd_vector_t      _minimum,
+  hnd_vector_t      _maximum,
+  size_t            _count
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_VECTOR_ARRAY_H__ */
@@ -18,6 +18,21 @@
 
 #include "renderer.h"
 
+/* @note Backend of the renderer made current last */
+static unsigned int current_backend = HND_RENDERER_GL;
+
+void
+hnd_make_renderer_current
+(
+  hnd_renderer_t *_renderer
+)
+{
+  if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
+    return;
+
+  current_backend = _renderer->backend;
+}
+
 void
 hnd_set_renderer_clear_color
 (
@@ -27,6 +42,9 @@ hnd_set_renderer_clear_color
   float _alpha
 )
 {
+  if (current_backend == HND_RENDERER_NULL)
+    return;
+
   glClearColor(_red, _green, _blue, _alpha);
 }
 
@@ -36,9 +54,84 @@ hnd_clear_render
   void
 )
 {
+  HND_PROFILE_SCOPE("hnd_clear_render");
+
+  if (current_backend == HND_RENDERER_NULL)
+    return;
+
   glClear(GL_COLOR_BUFFER_BIT);
 }
 
+void
+hnd_set_renderer_frame_limit
+(
+  hnd_renderer_t *_renderer,
+  uint64_t        _target_ns
+)
+{
+  if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
+    return;
+
+  hnd_set_frame_limit(&_renderer->frame_limiter, _target_ns);
+}
+
+const hnd_frame_stats_t *
+hnd_get_renderer_frame_stats
+(
+  const hnd_renderer_t *_renderer
+)
+{
+  if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
+    return NULL;
+
+  return &_renderer->frame_limiter.stats;
+}
+
+hnd_allocator_t
+hnd_get_frame_allocator
+(
+  hnd_renderer_t *_renderer
+)
+{
+  return hnd_get_arena_allocator(&_renderer->frame_arena);
+}
+
+void
+hnd_set_renderer_view
+(
+  hnd_renderer_t *_renderer,
+  hnd_matrix_t    _view_projection
+)
+{
+  hnd_extract_frustum(_view_projection, &_renderer->frustum);
+}
+
+size_t
+hnd_cull_renderer_aabbs
+(
+  hnd_renderer_t   *_renderer,
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  uint32_t         *_visible
+)
+{
+  return hnd_cull_aabb_frustum(_centers, _extents, _count, &_renderer->frustum, _visible);
+}
+
+size_t
+hnd_cull_renderer_spheres
+(
+  hnd_renderer_t   *_renderer,
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  uint32_t         *_visible
+)
+{
+  return hnd_cull_sphere_frustum(_centers, _radii, _count, &_renderer->frustum, _visible);
+}
+
 void
 hnd_resize_renderer_viewport
 (
@@ -46,6 +139,9 @@ hnd_resize_renderer_viewport
   unsigned int _height
 )
 {
+  if (current_backend == HND_RENDERER_NULL)
+    return;
+
   if (_height == 0)
     _height = 1;
 
@@ -64,6 +64,125 @@ hnd_set_fb_configs
   return HND_OK;
 }
 
+#ifdef HND_USE_EGL
+static EGLint offscreen_configs[] =
+{
+  EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+  EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+  EGL_RED_SIZE,        8,
+  EGL_GREEN_SIZE,      8,
+  EGL_BLUE_SIZE,       8,
+  EGL_ALPHA_SIZE,      8,
+  EGL_DEPTH_SIZE,      24,
+  EGL_STENCIL_SIZE,    8,
+  EGL_NONE
+};
+
+/**
+ * @brief Gets an EGL display that needs no display server.
+ *
+ * @note Mesa's surfaceless platform first, then whatever the default one is.
+ */
+static EGLDisplay
+hnd_get_offscreen_display
+(
+  void
+)
+{
+  const char *extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  if (extensions && strstr(extensions, "EGL_MESA_platform_surfaceless"))
+  {
+    EGLDisplay display = eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (display != EGL_NO_DISPLAY)
+      return display;
+  }
+
+  return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+/**
+ * @brief Creates an EGL context with a pbuffer, or none if the driver can't make one,
+ * and makes it current.
+ *
+ * @note Failing isn't fatal, the caller may fall back to the null backend.
+ */
+static int
+hnd_init_offscreen_renderer
+(
+  hnd_linux_renderer_t *_renderer
+)
+{
+  _renderer->egl_context = EGL_NO_CONTEXT;
+  _renderer->egl_surface = EGL_NO_SURFACE;
+
+  _renderer->egl_display = hnd_get_offscreen_display();
+  if (_renderer->egl_display == EGL_NO_DISPLAY ||
+      !eglInitialize(_renderer->egl_display, NULL, NULL))
+  {
+    hnd_print_debug(HND_WARNING, "Could not open an EGL display", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  if (!eglBindAPI(EGL_OPENGL_API))
+  {
+    hnd_print_debug(HND_WARNING, "EGL can't create OpenGL contexts", HND_FAILURE);
+    eglTerminate(_renderer->egl_display);
+
+    return HND_NK;
+  }
+
+  EGLConfig config;
+  EGLint config_count = 0;
+  eglChooseConfig(_renderer->egl_display, offscreen_configs, &config, 1, &config_count);
+  if (config_count == 0)
+  {
+    /* @note Surfaceless displays may have no pbuffer configs, any will do then */
+    EGLint any_config[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    eglChooseConfig(_renderer->egl_display, any_config, &config, 1, &config_count);
+  }
+
+  _renderer->egl_context = config_count
+    ? eglCreateContext(_renderer->egl_display, config, EGL_NO_CONTEXT, NULL)
+    : EGL_NO_CONTEXT;
+  if (_renderer->egl_context == EGL_NO_CONTEXT)
+  {
+    hnd_print_debug(HND_WARNING, "Could not create an EGL context", HND_FAILURE);
+    eglTerminate(_renderer->egl_display);
+
+    return HND_NK;
+  }
+
+  EGLint pbuffer_attributes[] =
+  {
+    EGL_WIDTH,  (EGLint)(_renderer->offscreen_width ? _renderer->offscreen_width : 1),
+    EGL_HEIGHT, (EGLint)(_renderer->offscreen_height ? _renderer->offscreen_height : 1),
+    EGL_NONE
+  };
+  _renderer->egl_surface = eglCreatePbufferSurface(_renderer->egl_display, config, pbuffer_attributes);
+
+  if (!eglMakeCurrent(_renderer->egl_display,
+                      _renderer->egl_surface,
+                      _renderer->egl_surface,
+                      _renderer->egl_context))
+  {
+    hnd_print_debug(HND_WARNING, "Could not make the EGL context current", HND_FAILURE);
+    if (_renderer->egl_surface != EGL_NO_SURFACE)
+      eglDestroySurface(_renderer->egl_display, _renderer->egl_surface);
+    eglDestroyContext(_renderer->egl_display, _renderer->egl_context);
+    eglTerminate(_renderer->egl_display);
+
+    return HND_NK;
+  }
+
+  hnd_print_debug(HND_LOG,
+                  HND_CREATED("offscreen OpenGL context"),
+                  _renderer->egl_surface != EGL_NO_SURFACE ? "pbuffer" : "surfaceless");
+
+  return HND_OK;
+}
+#endif /* HND_USE_EGL */
+
 int
 hnd_init_renderer
 (
@@ -72,6 +191,34 @@ hnd_init_renderer
 {
   if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
     return HND_NK;
+
+  /* @note No view set yet, an all zero frustum culls nothing */
+  memset(&_renderer->frustum, 0x00, sizeof(hnd_frustum_t));
+  hnd_init_arena(&_renderer->frame_arena, HND_FRAME_ARENA_BLOCK_SIZE, HND_MEMORY_HUGE_PAGES, HND_MEMORY_TAG_RENDERER);
+  hnd_init_frame_limiter(&_renderer->frame_limiter, 0);
+
+  if (_renderer->backend == HND_RENDERER_NULL)
+  {
+    hnd_make_renderer_current(_renderer);
+
+    return HND_OK;
+  }
+
+  if (_renderer->backend == HND_RENDERER_OFFSCREEN)
+  {
+#ifdef HND_USE_EGL
+    if (!hnd_init_offscreen_renderer(_renderer))
+      return HND_NK;
+
+    hnd_make_renderer_current(_renderer);
+
+    return HND_OK;
+#else
+    hnd_print_debug(HND_WARNING, "Offscreen rendering needs HOUND_USE_EGL", HND_FAILURE);
+
+    return HND_NK;
+#endif /* HND_USE_EGL */
+  }
   
   if (!hnd_set_fb_configs(_renderer))
     return HND_NK;
@@ -96,8 +243,27 @@ hnd_end_renderer
   if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
     return;
 
-  glXDestroyContext(_renderer->display, _renderer->gl_context);
-  XCloseDisplay(_renderer->display);
+  switch (_renderer->backend)
+  {
+  case HND_RENDERER_OFFSCREEN:
+#ifdef HND_USE_EGL
+    eglMakeCurrent(_renderer->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (_renderer->egl_surface != EGL_NO_SURFACE)
+      eglDestroySurface(_renderer->egl_display, _renderer->egl_surface);
+    eglDestroyContext(_renderer->egl_display, _renderer->egl_context);
+    eglTerminate(_renderer->egl_display);
+#endif /* HND_USE_EGL */
+
+    break;
+  case HND_RENDERER_GL:
+    glXDestroyContext(_renderer->display, _renderer->gl_context);
+    XCloseDisplay(_renderer->display);
+
+    break;
+  default:
+    break;
+  }
+  hnd_end_arena(&_renderer->frame_arena);
   
   hnd_print_debug(HND_LOG, HND_ENDED("opengl renderer"), HND_SUCCESS);  
 }
@@ -108,5 +274,72 @@ hnd_swap_renderer_buffers
   hnd_renderer_t *_renderer
 )
 {
-  glXSwapBuffers(_renderer->display, _renderer->gl_window);
+  HND_PROFILE_SCOPE("hnd_swap_renderer_buffers");
+
+  hnd_wait_frame_limiter(&_renderer->frame_limiter);
+
+  /* @note Offscreen frames stay in the pbuffer, or the caller's framebuffer, to be read back */
+  if (_renderer->backend == HND_RENDERER_GL)
+    glXSwapBuffers(_renderer->display, _renderer->gl_window);
+
+  hnd_reset_arena(&_renderer->frame_arena);
+  hnd_end_memory_frame();
+}
+
+typedef void (*hnd_glx_swap_interval_ext_t)(Display *, GLXDrawable, int);
+typedef int (*hnd_glx_swap_interval_mesa_t)(unsigned int);
+
+int
+hnd_set_renderer_swap_interval
+(
+  hnd_renderer_t *_renderer,
+  int             _interval
+)
+{
+  if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  if (_renderer->backend == HND_RENDERER_NULL)
+    return HND_OK;
+
+  if (_renderer->backend == HND_RENDERER_OFFSCREEN)
+  {
+#ifdef HND_USE_EGL
+    return eglSwapInterval(_renderer->egl_display, _interval < 0 ? 1 : _interval) ? HND_OK : HND_NK;
+#else
+    return HND_NK;
+#endif /* HND_USE_EGL */
+  }
+
+  const char *extensions = glXQueryExtensionsString(_renderer->display, _renderer->default_screen);
+  if (!extensions)
+    extensions = "";
+
+  /* @note Negative intervals are adaptive, only with swap_control_tear */
+  if (strstr(extensions, "GLX_EXT_swap_control"))
+  {
+    hnd_glx_swap_interval_ext_t swap_interval =
+      (hnd_glx_swap_interval_ext_t)glXGetProcAddress((const GLubyte *)"glXSwapIntervalEXT");
+    if (swap_interval)
+    {
+      if (_interval < 0 && !strstr(extensions, "GLX_EXT_swap_control_tear"))
+        _interval = 1;
+
+      swap_interval(_renderer->display, _renderer->gl_window, _interval);
+
+      return HND_OK;
+    }
+  }
+
+  if (strstr(extensions, "GLX_MESA_swap_control"))
+  {
+    hnd_glx_swap_interval_mesa_t swap_interval =
+      (hnd_glx_swap_interval_mesa_t)glXGetProcAddress((const GLubyte *)"glXSwapIntervalMESA");
+    if (swap_interval)
+      return swap_interval((unsigned int)(_interval < 0 ? 1 : _interval)) == 0;
+  }
+
+  hnd_print_debug(HND_WARNING, "Swap interval control isn't supported", HND_FAILURE);
+
+  return HND_NK;
 }
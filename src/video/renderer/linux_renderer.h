@@ -27,9 +27,15 @@ extern "C"
 #endif /* __cplusplus */
 
 #include "../video.h"
+#include "../../util/math/cull.h"
+#include "../../core/memory/memory.h"
+#include "../../core/clock/clock.h"
 
 typedef struct hnd_linux_renderer_t
 {
+  /* @note HND_RENDERER_*, set before hnd_init_renderer */
+  unsigned int backend;
+
   Display *display;
   GLXFBConfig *fb_configs;
   GLXFBConfig current_fb_config;
@@ -40,6 +46,25 @@ typedef struct hnd_linux_renderer_t
 
   GLXContext gl_context;
   GLXWindow gl_window;
+
+  /* @note Offscreen backend. The surface is EGL_NO_SURFACE when surfaceless, draw into
+   * a framebuffer object then.
+   */
+  unsigned int offscreen_width;
+  unsigned int offscreen_height;
+#ifdef HND_USE_EGL
+  EGLDisplay egl_display;
+  EGLContext egl_context;
+  EGLSurface egl_surface;
+#endif /* HND_USE_EGL */
+
+  hnd_frustum_t frustum;
+
+  /* @note Per frame scratch memory, reset by hnd_swap_renderer_buffers */
+  hnd_arena_t frame_arena;
+
+  /* @note Paces and times hnd_swap_renderer_buffers */
+  hnd_frame_limiter_t frame_limiter;
 } hnd_linux_renderer_t;
 
 #ifdef __cplusplus
@@ -25,6 +25,7 @@ extern "C"
 #endif /* __cplusplus */
 
 #include "../../core/core.h"
+#include "../../core/profile/profile.h"
 #include "../video.h"
  
 #ifdef HND_WIN32
@@ -35,9 +36,30 @@ typedef hnd_win32_renderer_t hnd_renderer_t;
 typedef hnd_linux_renderer_t hnd_renderer_t;
 #endif /* HND_WIN32 */
 
+/**
+ * @note Renderer backends. GL draws to the window through GLX or WGL, offscreen through
+ * EGL without any display server, e.g. Mesa's llvmpipe, and null skips GL entirely.
+ */
+#define HND_RENDERER_GL        0
+#define HND_RENDERER_OFFSCREEN 1
+#define HND_RENDERER_NULL      2
+
+/**
+ * @note Swap intervals. Adaptive syncs like on, but doesn't wait when a frame is late.
+ */
+#define HND_VSYNC_OFF       0
+#define HND_VSYNC_ON        1
+#define HND_VSYNC_ADAPTIVE -1
+
+/* @note A single huge page, so small frames never need a second block */
+#define HND_FRAME_ARENA_BLOCK_SIZE HND_HUGE_PAGE_SIZE
+
 /**
  * @brief Initialises given renderer.
  *
+ * @note Uses the backend set in _renderer->backend. An offscreen renderer also takes its
+ * size from offscreen_width and offscreen_height, and is made current right away.
+ *
  * @param _renderer Specifies the renderer to initialise.
  *
  * @return The function state. HND_OK or HND_NK.
@@ -59,6 +81,18 @@ hnd_end_renderer
   hnd_renderer_t *_renderer
 );
 
+/**
+ * @brief Makes the renderer's backend the one the global GL functions below use.
+ *
+ * @note Used by the platform implementations once a context is current. With the null
+ * backend current they do nothing.
+ */
+void
+hnd_make_renderer_current
+(
+  hnd_renderer_t *_renderer
+);
+
 /**
  * @brief Sets teh colour used to clear the window before redrawing.
  *
@@ -88,6 +122,9 @@ hnd_clear_render
 /**
  * @brief Swaps rendering buffers.
  *
+ * @note Waits on the renderer's frame limiter first, see hnd_set_renderer_frame_limit.
+ * Also resets the renderer's frame arena, see hnd_get_frame_allocator.
+ *
  * @param _window Specifies window whose buffers should be swapped.
  */
 void
@@ -96,6 +133,105 @@ hnd_swap_renderer_buffers
   hnd_renderer_t *_renderer
 );
 
+/**
+ * @brief Sets how many vertical blanks a swap waits for.
+ *
+ * @note Adaptive falls back to on where the driver lacks it. The null backend accepts
+ * anything and does nothing.
+ *
+ * @param _renderer Specifies the renderer, its context current.
+ * @param _interval Specifies HND_VSYNC_*, or a number of blanks.
+ *
+ * @return HND_NK if the driver can't control the swap interval.
+ */
+int
+hnd_set_renderer_swap_interval
+(
+  hnd_renderer_t *_renderer,
+  int             _interval
+);
+
+/**
+ * @brief Makes hnd_swap_renderer_buffers hold frames to a target frame time, sleeping
+ * rather than spinning.
+ *
+ * @param _renderer  Specifies the renderer.
+ * @param _target_ns Specifies the frame time, or 0 to not limit.
+ */
+void
+hnd_set_renderer_frame_limit
+(
+  hnd_renderer_t *_renderer,
+  uint64_t        _target_ns
+);
+
+/**
+ * @brief Gets the frame times measured by hnd_swap_renderer_buffers.
+ */
+const hnd_frame_stats_t *
+hnd_get_renderer_frame_stats
+(
+  const hnd_renderer_t *_renderer
+);
+
+/**
+ * @brief Gets an allocator for memory that only lives until the next buffer swap.
+ *
+ * @note Allocating is a pointer bump and the whole frame is freed at once in O(1), so
+ * per frame data never touches the heap.
+ *
+ * @param _renderer Specifies the renderer owning the frame arena.
+ */
+hnd_allocator_t
+hnd_get_frame_allocator
+(
+  hnd_renderer_t *_renderer
+);
+
+/**
+ * @brief Sets the camera used to cull what gets submitted.
+ *
+ * @param _renderer        Specifies the renderer.
+ * @param _view_projection Specifies the camera's projection * view matrix.
+ */
+void
+hnd_set_renderer_view
+(
+  hnd_renderer_t *_renderer,
+  hnd_matrix_t    _view_projection
+);
+
+/**
+ * @brief Culls AABBs against the renderer's view, see hnd_cull_aabb_frustum.
+ *
+ * @note Meant to run between hnd_clear_render and hnd_swap_renderer_buffers, so only the
+ * returned indices are submitted. Nothing is culled until a view is set.
+ *
+ * @return How many indices were written to _visible.
+ */
+size_t
+hnd_cull_renderer_aabbs
+(
+  hnd_renderer_t   *_renderer,
+  hnd_vector_soa_t *_centers,
+  hnd_vector_soa_t *_extents,
+  size_t            _count,
+  uint32_t         *_visible
+);
+
+/**
+ * @brief Culls spheres, or circles, against the renderer's view. See hnd_cull_renderer_aabbs.
+ */
+size_t
+hnd_cull_renderer_spheres
+(
+  hnd_renderer_t   *_renderer,
+  hnd_vector_soa_t *_centers,
+  float            *_radii,
+  size_t            _count,
+  uint32_t         *_visible
+);
+
 /**
  * @brief Sets new rendereing area.
  *
@@ -57,6 +57,25 @@ hnd_init_renderer
   if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
     return HND_NK;
 
+  /* @note No view set yet, an all zero frustum culls nothing */
+  memset(&_renderer->frustum, 0x00, sizeof(hnd_frustum_t));
+  hnd_init_arena(&_renderer->frame_arena, HND_FRAME_ARENA_BLOCK_SIZE, HND_MEMORY_HUGE_PAGES, HND_MEMORY_TAG_RENDERER);
+  hnd_init_frame_limiter(&_renderer->frame_limiter, 0);
+
+  if (_renderer->backend == HND_RENDERER_OFFSCREEN)
+  {
+    hnd_print_debug(HND_WARNING, "Offscreen rendering isn't supported on windows", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  if (_renderer->backend == HND_RENDERER_NULL)
+  {
+    hnd_make_renderer_current(_renderer);
+
+    return HND_OK;
+  }
+
   _renderer->pixel_format = ChoosePixelFormat(_renderer->device_context, &pixel_format_descriptor);
   if (!hnd_assert(_renderer->pixel_format != 0, "Could not choose pixel format"))
     return HND_NK;
@@ -71,6 +90,7 @@ hnd_init_renderer
   if (!hnd_assert(wglMakeCurrent(_renderer->device_context, _renderer->gl_context),
                   "Could not make renderer context current"))
     return HND_NK;
+  hnd_make_renderer_current(_renderer);
   
   hnd_print_debug(HND_LOG, HND_CREATED("renderer"), HND_SUCCESS);
   return HND_OK;
@@ -82,8 +102,12 @@ hnd_end_renderer
   hnd_renderer_t *_renderer
 )
 {
-  wglMakeCurrent(NULL, NULL);
-  wglDeleteContext(_renderer->gl_context);
+  if (_renderer->backend == HND_RENDERER_GL)
+  {
+    wglMakeCurrent(NULL, NULL);
+    wglDeleteContext(_renderer->gl_context);
+  }
+  hnd_end_arena(&_renderer->frame_arena);
   
   hnd_print_debug(HND_LOG, HND_ENDED("renderer"), HND_SUCCESS);
 }
@@ -94,5 +118,43 @@ hnd_swap_renderer_buffers
   hnd_renderer_t *_renderer
 )
 {
-  SwapBuffers(_renderer->device_context);
+  HND_PROFILE_SCOPE("hnd_swap_renderer_buffers");
+
+  hnd_wait_frame_limiter(&_renderer->frame_limiter);
+
+  if (_renderer->backend == HND_RENDERER_GL)
+    SwapBuffers(_renderer->device_context);
+  hnd_reset_arena(&_renderer->frame_arena);
+  hnd_end_memory_frame();
+}
+
+typedef BOOL (WINAPI *hnd_wgl_swap_interval_ext_t)(int);
+
+int
+hnd_set_renderer_swap_interval
+(
+  hnd_renderer_t *_renderer,
+  int             _interval
+)
+{
+  if (!hnd_assert(_renderer != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  if (_renderer->backend == HND_RENDERER_NULL)
+    return HND_OK;
+
+  hnd_wgl_swap_interval_ext_t swap_interval =
+    (hnd_wgl_swap_interval_ext_t)wglGetProcAddress("wglSwapIntervalEXT");
+  if (!swap_interval)
+  {
+    hnd_print_debug(HND_WARNING, "Swap interval control isn't supported", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  /* @note Adaptive needs WGL_EXT_swap_control_tear, plain vsync otherwise */
+  if (swap_interval(_interval))
+    return HND_OK;
+
+  return _interval < 0 && swap_interval(1);
 }
@@ -20,12 +20,26 @@
 #define __HND_WIN32_OPENGL_RENDERER_H__
 
 #include "../video.h"
+#include "../../util/math/cull.h"
+#include "../../core/memory/memory.h"
+#include "../../core/clock/clock.h"
 
 typedef struct hnd_win32_renderer_t
 {
+  /* @note HND_RENDERER_*, set before hnd_init_renderer. Offscreen isn't supported. */
+  unsigned int backend;
+
   HGLRC gl_context;
   int pixel_format;
   HDC device_context;
+
+  hnd_frustum_t frustum;
+
+  /* @note Per frame scratch memory, reset by hnd_swap_renderer_buffers */
+  hnd_arena_t frame_arena;
+
+  /* @note Paces and times hnd_swap_renderer_buffers */
+  hnd_frame_limiter_t frame_limiter;
 } hnd_win32_renderer_t;
 
 #endif /* __HND_WIN32_OPENGL_RENDERER_H__ */
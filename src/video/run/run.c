@@ -0,0 +1,166 @@
+/**
+ * @file src/video/run/run.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "run.h"
+
+void
+hnd_init_run
+(
+  hnd_run_t *_run,
+  uint64_t   _step_ns
+)
+{
+  if (!hnd_assert(_run != NULL, HND_SYNTAX))
+    return;
+
+  memset(_run, 0x00, sizeof(hnd_run_t));
+  _run->step_ns = _step_ns;
+  _run->max_steps = HND_RUN_MAX_STEPS;
+}
+
+/**
+ * @brief Runs a single step and checks the step limit.
+ */
+static void
+hnd_step_run
+(
+  hnd_run_t *_run,
+  float      _dt
+)
+{
+  HND_PROFILE_SCOPE("hnd_run update");
+
+  if (_run->update)
+    _run->update(_run, _dt);
+
+  _run->time_ns += _run->step_ns;
+  ++_run->step_count;
+
+  if (_run->step_limit && _run->step_count >= _run->step_limit)
+    _run->running = HND_NK;
+}
+
+int
+hnd_run
+(
+  hnd_window_t *_window,
+  hnd_run_t    *_run
+)
+{
+  if (!hnd_assert(_window != NULL && _run != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (!hnd_assert(_run->step_ns != 0, "The fixed step can't be 0"))
+    return HND_NK;
+
+  _run->window = _window;
+  _run->running = HND_OK;
+
+  /* @note The step is fixed, so is the dt every update sees */
+  float dt = (float)((double)_run->step_ns / (double)HND_NANOSECONDS_PER_SECOND);
+  uint32_t max_steps = _run->max_steps ? _run->max_steps : 1;
+
+  hnd_input_event_t events[HND_RUN_EVENT_CAPACITY];
+  uint64_t last_frame = hnd_get_clock_ns();
+  uint64_t frame_ticks = hnd_get_clock_ticks();
+
+  while (_run->running && _window->running)
+  {
+    HND_PROFILE_SCOPE("hnd_run frame");
+
+    size_t count;
+    do
+    {
+      count = hnd_poll_event_batch(_window, events, HND_RUN_EVENT_CAPACITY);
+      if (_run->input && count)
+        _run->input(_run, events, count);
+    } while (count == HND_RUN_EVENT_CAPACITY);
+
+    uint64_t update_ticks = hnd_get_clock_ticks();
+    float alpha = 1.0f;
+    if (_run->unthrottled)
+      hnd_step_run(_run, dt);
+    else
+    {
+      uint64_t now = hnd_get_clock_ns();
+      _run->accumulator += now - last_frame;
+      last_frame = now;
+
+      uint32_t steps = 0;
+      while (_run->running && _run->accumulator >= _run->step_ns && steps < max_steps)
+      {
+        hnd_step_run(_run, dt);
+        _run->accumulator -= _run->step_ns;
+        ++steps;
+      }
+
+      /* @note Out of steps, whatever is still behind is let go, only the fraction of a
+       * step is kept for the alpha.
+       */
+      if (steps == max_steps && _run->accumulator >= _run->step_ns)
+      {
+        uint64_t remainder = _run->accumulator % _run->step_ns;
+        _run->dropped_ns += _run->accumulator - remainder;
+        _run->accumulator = remainder;
+      }
+
+      /* @note Stopping by step_limit can leave more than a step behind */
+      if (_run->accumulator < _run->step_ns)
+        alpha = (float)((double)_run->accumulator / (double)_run->step_ns);
+    }
+
+    uint64_t render_ticks = hnd_get_clock_ticks();
+    if (_run->render)
+    {
+      HND_PROFILE_SCOPE("hnd_run render");
+      _run->render(_run, alpha);
+    }
+
+    uint64_t swap_ticks = hnd_get_clock_ticks();
+    hnd_swap_renderer_buffers(&_window->renderer);
+
+    /* @note A frame runs from one frame's input to the next, waits included */
+    uint64_t end_ticks = hnd_get_clock_ticks();
+    if (_run->timings)
+    {
+      hnd_frame_timings_t *timings = _run->timings;
+      hnd_add_timing_sample(&timings->channels[HND_FRAME_TIMING_FRAME], hnd_ticks_to_ns(end_ticks - frame_ticks));
+      hnd_add_timing_sample(&timings->channels[HND_FRAME_TIMING_UPDATE], hnd_ticks_to_ns(render_ticks - update_ticks));
+      hnd_add_timing_sample(&timings->channels[HND_FRAME_TIMING_RENDER], hnd_ticks_to_ns(swap_ticks - render_ticks));
+      hnd_add_timing_sample(&timings->channels[HND_FRAME_TIMING_SWAP], hnd_ticks_to_ns(end_ticks - swap_ticks));
+    }
+    frame_ticks = end_ticks;
+
+    ++_run->frame_count;
+  }
+
+  _run->running = HND_NK;
+
+  return HND_OK;
+}
+
+void
+hnd_stop_run
+(
+  hnd_run_t *_run
+)
+{
+  if (!hnd_assert(_run != NULL, HND_SYNTAX))
+    return;
+
+  _run->running = HND_NK;
+}
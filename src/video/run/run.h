@@ -0,0 +1,132 @@
+/**
+ * @file src/video/run/run.h
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ *
+ * @note Main loop. Simulation advances in fixed steps, rendering happens once per frame
+ * and gets how far the simulation is into the next step, so motion can be interpolated
+ * between the last two steps instead of stuttering with the frame rate.
+ */
+
+#ifndef __HND_RUN_H__
+#define __HND_RUN_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include "../../core/clock/timing.h"
+#include "../window/window.h"
+
+/* @note Default cap on steps per frame. Past it, the simulation slows down instead of
+ * taking ever longer frames to catch up.
+ */
+#define HND_RUN_MAX_STEPS 8
+
+/* @note Events handed to the input function per hnd_poll_event_batch */
+#define HND_RUN_EVENT_CAPACITY 64
+
+typedef struct hnd_run_t hnd_run_t;
+
+typedef void (*hnd_run_input_function_t)(hnd_run_t *_run, const hnd_input_event_t *_events, size_t _count);
+typedef void (*hnd_run_update_function_t)(hnd_run_t *_run, float _dt);
+typedef void (*hnd_run_render_function_t)(hnd_run_t *_run, float _alpha);
+
+/**
+ * @brief A fixed step loop. Fill it with hnd_init_run, set the functions and hand it
+ * to hnd_run.
+ */
+struct hnd_run_t
+{
+  /* @note Any function can be NULL */
+  hnd_run_input_function_t input;
+  hnd_run_update_function_t update;
+  hnd_run_render_function_t render;
+  void *data;
+
+  uint64_t step_ns;
+  uint32_t max_steps;
+  /* @note Runs one step per frame, back to back, see hnd_run */
+  int unthrottled;
+  /* @note Stops after this many steps, 0 runs until the window closes */
+  uint64_t step_limit;
+  /* @note Frame, update, render and swap durations go here, if set */
+  hnd_frame_timings_t *timings;
+
+  /* @note Set by hnd_run */
+  hnd_window_t *window;
+  int running;
+
+  /* @note Simulated time, step_count * step_ns, the time base the simulation sees */
+  uint64_t time_ns;
+  uint64_t step_count;
+  uint64_t frame_count;
+  /* @note Wall time not yet simulated, below step_ns between frames */
+  uint64_t accumulator;
+  /* @note Wall time thrown away by the max_steps cap */
+  uint64_t dropped_ns;
+};
+
+/**
+ * @param _run     Specifies the loop.
+ * @param _step_ns Specifies the fixed step, e.g. HND_NANOSECONDS_PER_SECOND / 100.
+ */
+void
+hnd_init_run
+(
+  hnd_run_t *_run,
+  uint64_t   _step_ns
+);
+
+/**
+ * @brief Runs the loop until the window closes, hnd_stop_run is called or step_limit
+ * steps went by.
+ *
+ * @note Each frame polls the window's events once and hands them to input, runs update
+ * as many times as the wall time since the last frame covers, up to max_steps, then
+ * calls render with the leftover fraction of a step and swaps the window's buffers.
+ * Frames are paced by the renderer's swap interval and frame limit.
+ *
+ * @note Unthrottled, every frame runs exactly one step no matter how long it took and
+ * render gets an alpha of 1, so an offline run is as fast as the machine and still steps
+ * the same way. Turn the renderer's vsync and frame limit off for it.
+ *
+ * @param _window Specifies the window.
+ * @param _run    Specifies the loop.
+ *
+ * @return HND_NK on invalid arguments.
+ */
+int
+hnd_run
+(
+  hnd_window_t *_window,
+  hnd_run_t    *_run
+);
+
+/**
+ * @brief Makes hnd_run return once the current frame is done.
+ */
+void
+hnd_stop_run
+(
+  hnd_run_t *_run
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __HND_RUN_H__ */
@@ -30,6 +30,13 @@ extern "C"
 #include <X11/Xlib.h>
 #include <X11/Xlib-xcb.h>
 #include <xcb/xcb.h>
+#ifdef HND_USE_XINPUT
+#include <xcb/xinput.h>
+#endif /* HND_USE_XINPUT */
+#ifdef HND_USE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif /* HND_USE_EGL */
 #endif /* HND_WIN32 */
 
 #include <GL/gl.h>
@@ -0,0 +1,154 @@
+/**
+ * @file src/video/window/common_window.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "window.h"
+
+/* @note Created with the first window and kept until exit. Ending it with the last window
+ * would start the generations over, and stale ids would resolve to the next window.
+ */
+static hnd_pool_t window_pool;
+static int window_pool_ready = HND_NK;
+
+/**
+ * @brief Ends the window pool at exit, before the debug leak report runs.
+ */
+static void
+hnd_end_window_pool
+(
+  void
+)
+{
+  hnd_end_pool(&window_pool);
+  window_pool_ready = HND_NK;
+}
+
+hnd_window_t *
+hnd_allocate_window
+(
+  void
+)
+{
+  if (!window_pool_ready)
+  {
+    hnd_allocator_t allocator = hnd_get_tagged_allocator(HND_MEMORY_TAG_WINDOW);
+    if (!hnd_init_pool(&window_pool, sizeof(hnd_window_t), HND_MAX_WINDOWS, &allocator))
+      return NULL;
+
+    window_pool_ready = HND_OK;
+    atexit(hnd_end_window_pool);
+  }
+
+  hnd_handle_t id = hnd_acquire_pool_object(&window_pool);
+  if (!hnd_assert(id != HND_INVALID_HANDLE, "Too many windows"))
+    return NULL;
+
+  hnd_window_t *new_window = hnd_get_pool_object(&window_pool, id);
+  new_window->id = id;
+  hnd_init_event_filter(&new_window->event_filter);
+
+  return new_window;
+}
+
+size_t
+hnd_pop_window_events
+(
+  hnd_window_t      *_window,
+  hnd_input_event_t *_events,
+  size_t             _capacity
+)
+{
+  /* @note A full batch may have left events behind, they belong to the same frame */
+  if (!_window->input_frame_open)
+    hnd_begin_input_frame(&_window->input);
+
+  size_t count = 0;
+  if (_window->replay)
+  {
+    /* @note Live events would only fill the ring up */
+    hnd_input_event_t live_event;
+    while (hnd_pop_event(&_window->events, &live_event));
+
+    count = hnd_poll_replay_batch(_window->replay, _events, _capacity);
+  }
+  else
+  {
+    while (count < _capacity && hnd_pop_event(&_window->events, &_events[count]))
+      ++count;
+  }
+
+  for (size_t i = 0; i < count; ++i)
+    hnd_update_input_state(&_window->input, &_events[i]);
+
+  _window->input_frame_open = _capacity && count == _capacity;
+
+  if (_window->recorder)
+  {
+    hnd_record_events(_window->recorder, _events, count);
+    if (!_window->input_frame_open)
+      hnd_end_recorder_frame(_window->recorder);
+  }
+
+  return count;
+}
+
+void
+hnd_set_window_recorder
+(
+  hnd_window_t   *_window,
+  hnd_recorder_t *_recorder
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return;
+
+  _window->recorder = _recorder;
+}
+
+void
+hnd_set_window_replay
+(
+  hnd_window_t *_window,
+  hnd_replay_t *_replay
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return;
+
+  _window->replay = _replay;
+}
+
+void
+hnd_free_window
+(
+  hnd_window_t *_window
+)
+{
+  hnd_release_pool_object(&window_pool, _window->id);
+}
+
+hnd_window_t *
+hnd_get_window
+(
+  hnd_handle_t _id
+)
+{
+  if (!window_pool_ready)
+    return NULL;
+
+  return hnd_get_pool_object(&window_pool, _id);
+}
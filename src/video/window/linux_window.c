@@ -17,6 +17,12 @@
  */
 
 #include "window.h"
+#include "../../core/clock/clock.h"
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 /**
  * @brief Connects to xcb/xli.
@@ -39,7 +45,12 @@ hnd_connect_to_xcb
   _window->renderer.default_screen = DefaultScreen(_window->renderer.display);
   _window->connection = XGetXCBConnection(_window->renderer.display);
   if (!hnd_assert(_window->connection != NULL, "Could not connect to X display"))
+  {
+    XCloseDisplay(_window->renderer.display);
+    _window->renderer.display = NULL;
+
     return HND_NK;
+  }
 
   XSetEventQueueOwner(_window->renderer.display, XCBOwnsEventQueue);
 
@@ -94,6 +105,89 @@ hnd_get_window_atoms
                       &_window->wm_delete_window->atom);
 }
 
+/**
+ * @brief Creates the epoll set hnd_wait_events sleeps on, with the xcb connection, the
+ * deadline timer and the input thread's wake up in it.
+ *
+ * @param _window Specifies the window.
+ *
+ * @return The function state. HND_OK or HND_NK.
+ */
+static int
+hnd_init_wait_sources
+(
+  hnd_linux_window_t *_window
+)
+{
+  _window->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  _window->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  _window->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (!hnd_assert(_window->epoll_fd >= 0 && _window->timer_fd >= 0 && _window->wake_fd >= 0,
+                  "Could not create the window's wait sources"))
+    return HND_NK;
+
+  if (!_window->headless &&
+      !hnd_add_wait_source(_window, xcb_get_file_descriptor(_window->connection)))
+    return HND_NK;
+
+  return hnd_add_wait_source(_window, _window->timer_fd) &&
+         hnd_add_wait_source(_window, _window->wake_fd);
+}
+
+/**
+ * @brief Asks for XInput2 raw motion, see hnd_set_window_relative_mouse.
+ *
+ * @note Raw events are only sent to the root window. Without HOUND_USE_XINPUT, or without
+ * the extension on the server, this does nothing and motion comes from core events.
+ *
+ * @param _window Specifies the window.
+ */
+static void
+hnd_init_xinput
+(
+  hnd_linux_window_t *_window
+)
+{
+#ifdef HND_USE_XINPUT
+  const xcb_query_extension_reply_t *extension = xcb_get_extension_data(_window->connection, &xcb_input_id);
+  if (!extension || !extension->present)
+  {
+    hnd_print_debug(HND_WARNING, "XInput2 is not available, no raw mouse motion", HND_FAILURE);
+
+    return;
+  }
+
+  /* @note 2.1 onwards keeps sending raw events while another client grabs the pointer */
+  xcb_input_xi_query_version_reply_t *version =
+    xcb_input_xi_query_version_reply(_window->connection,
+                                     xcb_input_xi_query_version(_window->connection, 2, 2),
+                                     NULL);
+  int supported = version && version->major_version >= 2;
+  free(version);
+  if (!supported)
+  {
+    hnd_print_debug(HND_WARNING, "XInput2 is too old, no raw mouse motion", HND_FAILURE);
+
+    return;
+  }
+
+  struct
+  {
+    xcb_input_event_mask_t header;
+    uint32_t mask;
+  } event_mask;
+  event_mask.header.deviceid = XCB_INPUT_DEVICE_ALL_MASTER;
+  event_mask.header.mask_len = 1;
+  event_mask.mask = XCB_INPUT_XI_EVENT_MASK_RAW_MOTION;
+  xcb_input_xi_select_events(_window->connection, _window->screen_data->root, 1, &event_mask.header);
+
+  _window->xinput_opcode = extension->major_opcode;
+  _window->input.raw_motion = HND_OK;
+#else
+  (void)_window;
+#endif /* HND_USE_XINPUT */
+}
+
 hnd_linux_window_t *
 hnd_create_window
 (
@@ -103,19 +197,32 @@ hnd_create_window
   unsigned int  _decoration
 )
 {
-  hnd_linux_window_t *new_window = malloc(sizeof(hnd_linux_window_t));
-  if (!hnd_assert(new_window != NULL, NULL))
+  HND_PROFILE_SCOPE("hnd_create_window");
+
+  hnd_linux_window_t *new_window = hnd_allocate_window();
+  if (!new_window)
     return NULL;
 
   new_window->title = (char *)_title;
-  hnd_copy_vector(_position, new_window->position);
-  hnd_copy_vector(_size, new_window->size);
+  hnd_copy_vec2(_position, new_window->position);
+  hnd_copy_vec2(_size, new_window->size);
   new_window->running = HND_OK;
+  new_window->focused = HND_OK;
+  new_window->visible = HND_OK;
+
+  new_window->epoll_fd = -1;
+  new_window->timer_fd = -1;
+  new_window->wake_fd = -1;
 
   if (!hnd_connect_to_xcb(new_window))
+  {
+    hnd_free_window(new_window);
+
     return NULL;
+  }
 
-  if (!hnd_init_renderer(&new_window->renderer))
+  if (!hnd_init_renderer(&new_window->renderer) ||
+      !hnd_init_wait_sources(new_window))
   {
     hnd_destroy_window(new_window);
 
@@ -141,7 +248,8 @@ hnd_create_window
                            XCB_EVENT_MASK_KEY_PRESS       |  
                            XCB_EVENT_MASK_KEY_RELEASE     |  
                            XCB_EVENT_MASK_PROPERTY_CHANGE |
-                           XCB_EVENT_MASK_STRUCTURE_NOTIFY;
+                           XCB_EVENT_MASK_STRUCTURE_NOTIFY |
+                           XCB_EVENT_MASK_FOCUS_CHANGE;
 
   new_window->value_list[0] = new_window->event_mask;
   new_window->value_list[1] = new_window->colormap_id;
@@ -164,6 +272,7 @@ hnd_create_window
 
   hnd_get_window_atoms(new_window);
   hnd_set_window_decoration(new_window, _decoration);
+  hnd_init_xinput(new_window);
 
   xcb_map_window(new_window->connection, new_window->handle);
   xcb_flush(new_window->connection);
@@ -190,12 +299,67 @@ hnd_create_window
 
     return NULL;
   }
+  hnd_make_renderer_current(&new_window->renderer);
   hnd_print_debug(HND_LOG, HND_CREATED("OpenGL context"), HND_SUCCESS);
 
   hnd_print_debug(HND_LOG, HND_CREATED("window"), HND_SUCCESS);
   return new_window;
 }
 
+hnd_linux_window_t *
+hnd_create_headless_window
+(
+  const char   *_title,
+  hnd_vector_t  _size,
+  unsigned int  _backend
+)
+{
+  HND_PROFILE_SCOPE("hnd_create_headless_window");
+
+  if (!hnd_assert(_backend == HND_RENDERER_OFFSCREEN || _backend == HND_RENDERER_NULL, HND_SYNTAX))
+    return NULL;
+
+  hnd_linux_window_t *new_window = hnd_allocate_window();
+  if (!new_window)
+    return NULL;
+
+  new_window->title = (char *)_title;
+  hnd_copy_vec2(_size, new_window->size);
+  new_window->running = HND_OK;
+  new_window->headless = HND_OK;
+  new_window->focused = HND_OK;
+  new_window->visible = HND_OK;
+  /* @note Nothing to end until the renderer is initialized */
+  new_window->renderer.backend = HND_RENDERER_NULL;
+
+  new_window->epoll_fd = -1;
+  new_window->timer_fd = -1;
+  new_window->wake_fd = -1;
+
+  /* @note hnd_wait_events still works, as a frame limiter */
+  if (!hnd_init_wait_sources(new_window))
+  {
+    hnd_destroy_window(new_window);
+
+    return NULL;
+  }
+
+  new_window->renderer.backend = _backend;
+  new_window->renderer.offscreen_width = (unsigned int)_size[0];
+  new_window->renderer.offscreen_height = (unsigned int)_size[1];
+  if (!hnd_init_renderer(&new_window->renderer))
+  {
+    hnd_print_debug(HND_WARNING, "Falling back to the null renderer", HND_FAILURE);
+
+    hnd_end_arena(&new_window->renderer.frame_arena);
+    new_window->renderer.backend = HND_RENDERER_NULL;
+    hnd_init_renderer(&new_window->renderer);
+  }
+
+  hnd_print_debug(HND_LOG, HND_CREATED("headless window"), HND_SUCCESS);
+  return new_window;
+}
+
 void
 hnd_destroy_window
 (
@@ -204,11 +368,31 @@ hnd_destroy_window
 {
   if (!hnd_assert(_window != NULL, HND_SYNTAX))
     return;
+  if (!hnd_assert(hnd_get_window(_window->id) == _window, "Window was already destroyed"))
+    return;
+
+  hnd_stop_input_thread(_window);
+  if (!_window->headless)
+  {
+    hnd_set_window_relative_mouse(_window, HND_NK);
+    if (_window->hidden_cursor != XCB_NONE)
+      xcb_free_cursor(_window->connection, _window->hidden_cursor);
+  }
+
+  if (_window->epoll_fd >= 0)
+    close(_window->epoll_fd);
+  if (_window->timer_fd >= 0)
+    close(_window->timer_fd);
+  if (_window->wake_fd >= 0)
+    close(_window->wake_fd);
 
   hnd_end_renderer(&_window->renderer);
-  xcb_free_colormap(_window->connection, _window->colormap_id);
+  if (!_window->headless)
+    xcb_free_colormap(_window->connection, _window->colormap_id);
 
   hnd_print_debug(HND_LOG, HND_ENDED("window"), HND_SUCCESS);
+
+  hnd_free_window(_window);
 }
 
 void
@@ -218,6 +402,8 @@ hnd_poll_events
   hnd_event_t        *_event
 )
 {
+  HND_PROFILE_SCOPE("hnd_poll_events");
+
   if (!hnd_assert(_window != NULL, HND_SYNTAX))
     return;
   if (!hnd_assert(_event != NULL, HND_SYNTAX))
@@ -227,6 +413,10 @@ hnd_poll_events
   
   _event->keyboard.pressed_key = HND_KEY_UNKNOWN;
   _event->keyboard.released_key = HND_KEY_UNKNOWN;
+  _event->xcb_event = NULL;
+  /* @note The input thread owns the connection's events, see hnd_start_input_thread */
+  if (_window->headless || __atomic_load_n(&_window->input_thread_running, __ATOMIC_ACQUIRE))
+    return;
 
   _event->xcb_event = xcb_poll_for_event(_window->connection);
   if (!_event->xcb_event)
@@ -266,6 +456,8 @@ hnd_poll_events
      * and releases it, and then begin spamming the pressed key. You probably saw this sometimes, when typing,
      * where you would click a key, and it would insert it, wait a couple milisseconds, and then begin spamming
      * that key.
+     *
+     * @note hnd_poll_event_batch filters those out, see hnd_event_filter_t.
      */
     xcb_key_release_event_t *temp_key_release_event = (xcb_key_release_event_t *)_event->xcb_event;
     _event->keyboard.released_key = temp_key_release_event->detail;
@@ -307,12 +499,6 @@ hnd_poll_events
     _event->mouse.position[0] = (float)temp_motion_notify_event->event_x;
     _event->mouse.position[1] = (float)temp_motion_notify_event->event_y;
 
-  } break;
-  case XCB_CONFIGURE_NOTIFY:
-  {
-    xcb_configure_notify_event_t *temp_configure_notify_event = (xcb_configure_notify_event_t *)_event->xcb_event;
-    printf("%d ; %d\n", temp_configure_notify_event->x, temp_configure_notify_event->y);
-
   } break;
   case XCB_CLIENT_MESSAGE:
   {
@@ -323,10 +509,589 @@ hnd_poll_events
     
   } break;
   default:
-    printf("hello\n");
-
     break;
   }
+
+  /* @note xcb allocates every event with malloc, it's ours to free */
+  free(_event->xcb_event);
+  _event->xcb_event = NULL;
+}
+
+/**
+ * @brief Translates an xcb event into a compact one.
+ *
+ * @note Categories masked out by the window's event filter are skipped here already.
+ *
+ * @return HND_NK if the event has nothing to report.
+ */
+static int
+hnd_translate_xcb_event
+(
+  hnd_linux_window_t  *_window,
+  xcb_generic_event_t *_xcb_event,
+  hnd_input_event_t   *_event
+)
+{
+  uint32_t mask = __atomic_load_n(&_window->event_filter.mask, __ATOMIC_RELAXED);
+
+  _event->time = hnd_get_clock_ns();
+  _event->server_time = 0;
+
+  switch (_xcb_event->response_type & 0x7f)
+  {
+  case XCB_EXPOSE:
+    xcb_flush(_window->connection);
+
+    return HND_NK;
+  /* @note Tracked to throttle hnd_wait_events. May run on the input thread. */
+  case XCB_FOCUS_IN:
+  case XCB_FOCUS_OUT:
+    __atomic_store_n(&_window->focused, (_xcb_event->response_type & 0x7f) == XCB_FOCUS_IN, __ATOMIC_RELAXED);
+
+    /* @note Whatever is let go from now on is never reported, the producer releases it all */
+    if ((_xcb_event->response_type & 0x7f) == XCB_FOCUS_OUT)
+      hnd_begin_input_release(&_window->event_filter, _event->time);
+
+    return HND_NK;
+  case XCB_MAP_NOTIFY:
+  case XCB_UNMAP_NOTIFY:
+    __atomic_store_n(&_window->visible, (_xcb_event->response_type & 0x7f) == XCB_MAP_NOTIFY, __ATOMIC_RELAXED);
+
+    return HND_NK;
+  case XCB_KEY_PRESS:
+  case XCB_KEY_RELEASE:
+  {
+    if (!(mask & HND_EVENT_MASK_KEY))
+      return HND_NK;
+
+    /* @note Press and release events share the same layout */
+    xcb_key_press_event_t *key_event = (xcb_key_press_event_t *)_xcb_event;
+
+    _event->type = (_xcb_event->response_type & 0x7f) == XCB_KEY_PRESS
+      ? HND_EVENT_KEY_PRESS
+      : HND_EVENT_KEY_RELEASE;
+    _event->server_time = key_event->time;
+    _event->key.code = key_event->detail;
+
+    return HND_OK;
+  }
+  case XCB_BUTTON_PRESS:
+  case XCB_BUTTON_RELEASE:
+  {
+    if (!(mask & HND_EVENT_MASK_MOUSE_BUTTON))
+      return HND_NK;
+
+    xcb_button_press_event_t *button_event = (xcb_button_press_event_t *)_xcb_event;
+    int press = (_xcb_event->response_type & 0x7f) == XCB_BUTTON_PRESS;
+
+    /* @note Scrolls are reported on press only */
+    if (!press &&
+        (button_event->detail == HND_MOUSE_BUTTON_MIDDLE_UP ||
+         button_event->detail == HND_MOUSE_BUTTON_MIDDLE_DOWN))
+      return HND_NK;
+
+    _event->type = press ? HND_EVENT_MOUSE_BUTTON_PRESS : HND_EVENT_MOUSE_BUTTON_RELEASE;
+    _event->server_time = button_event->time;
+    _event->button.code = button_event->detail;
+    _event->button.x = button_event->event_x;
+    _event->button.y = button_event->event_y;
+
+    return HND_OK;
+  }
+  case XCB_MOTION_NOTIFY:
+  {
+    if (!(mask & HND_EVENT_MASK_MOUSE_MOVE))
+      return HND_NK;
+
+    xcb_motion_notify_event_t *motion_event = (xcb_motion_notify_event_t *)_xcb_event;
+
+    /* @note Deltas are filled in by the event filter */
+    _event->type = HND_EVENT_MOUSE_MOVE;
+    _event->server_time = motion_event->time;
+    _event->motion.x = motion_event->event_x;
+    _event->motion.y = motion_event->event_y;
+    _event->motion.dx = 0;
+    _event->motion.dy = 0;
+
+    return HND_OK;
+  }
+#ifdef HND_USE_XINPUT
+  case XCB_GE_GENERIC:
+  {
+    xcb_ge_generic_event_t *generic_event = (xcb_ge_generic_event_t *)_xcb_event;
+    if (generic_event->extension != _window->xinput_opcode ||
+        generic_event->event_type != XCB_INPUT_RAW_MOTION)
+      return HND_NK;
+
+    /* @note Selected on the root window, so it keeps coming with another window focused */
+    if (!(mask & HND_EVENT_MASK_MOUSE_MOVE) || !__atomic_load_n(&_window->focused, __ATOMIC_RELAXED))
+      return HND_NK;
+
+    xcb_input_raw_motion_event_t *raw_event = (xcb_input_raw_motion_event_t *)_xcb_event;
+    const uint32_t *valuators = xcb_input_raw_button_press_valuator_mask(raw_event);
+    const xcb_input_fp3232_t *values = xcb_input_raw_button_press_axisvalues_raw(raw_event);
+    int valuator_count = xcb_input_raw_button_press_valuator_mask_length(raw_event) * 32;
+
+    _event->type = HND_EVENT_MOUSE_RAW_MOTION;
+    _event->server_time = raw_event->time;
+    _event->raw_motion.dx = 0.0f;
+    _event->raw_motion.dy = 0.0f;
+
+    /* @note Only changed valuators carry a value, packed in mask order. 0 and 1 are x and y,
+     * the rest are scrolling and such.
+     */
+    for (int i = 0, value = 0; i < 2 && i < valuator_count; ++i)
+    {
+      if (!((valuators[0] >> i) & 1))
+        continue;
+
+      float delta = (float)values[value].integral + (float)values[value].frac / 4294967296.0f;
+      if (i == 0)
+        _event->raw_motion.dx = delta;
+      else
+        _event->raw_motion.dy = delta;
+      ++value;
+    }
+
+    return _event->raw_motion.dx != 0.0f || _event->raw_motion.dy != 0.0f;
+  }
+#endif /* HND_USE_XINPUT */
+  case XCB_CONFIGURE_NOTIFY:
+  {
+    if (!(mask & HND_EVENT_MASK_WINDOW))
+      return HND_NK;
+
+    xcb_configure_notify_event_t *configure_event = (xcb_configure_notify_event_t *)_xcb_event;
+
+    _event->type = HND_EVENT_WINDOW_CONFIGURE;
+    _event->configure.x = configure_event->x;
+    _event->configure.y = configure_event->y;
+    _event->configure.width = configure_event->width;
+    _event->configure.height = configure_event->height;
+
+    return HND_OK;
+  }
+  case XCB_CLIENT_MESSAGE:
+  {
+    xcb_client_message_event_t *client_message_event = (xcb_client_message_event_t *)_xcb_event;
+    if (client_message_event->data.data32[0] != _window->wm_delete_window->atom)
+      return HND_NK;
+
+    /* @note May run on the input thread */
+    __atomic_store_n(&_window->running, HND_NK, __ATOMIC_RELEASE);
+    _event->type = HND_EVENT_WINDOW_CLOSE;
+
+    return HND_OK;
+  }
+  default:
+    return HND_NK;
+  }
+}
+
+/**
+ * @brief Moves every pending xcb event into the window's ring.
+ *
+ * @note Stops once the ring is full, the rest stays queued in xcb. With the input thread
+ * on, it's the one reading xcb and this does nothing.
+ */
+static void
+hnd_drain_xcb_events
+(
+  hnd_linux_window_t *_window
+)
+{
+  if (_window->headless || __atomic_load_n(&_window->input_thread_running, __ATOMIC_ACQUIRE))
+    return;
+
+  while (hnd_get_event_count(&_window->events) <= HND_EVENT_RING_CAPACITY - HND_EVENT_FILTER_SLOTS)
+  {
+    /* @note Focus loss releases go before anything newer */
+    if (hnd_release_held_input(&_window->event_filter, &_window->events))
+      continue;
+
+    xcb_generic_event_t *xcb_event = xcb_poll_for_event(_window->connection);
+    if (!xcb_event)
+      break;
+
+    hnd_input_event_t event;
+    if (hnd_translate_xcb_event(_window, xcb_event, &event))
+      hnd_filter_event(&_window->event_filter, &_window->events, &event);
+
+    free(xcb_event);
+  }
+
+  hnd_flush_event_filter(&_window->event_filter, &_window->events);
+}
+
+size_t
+hnd_poll_event_batch
+(
+  hnd_linux_window_t *_window,
+  hnd_input_event_t  *_events,
+  size_t              _capacity
+)
+{
+  HND_PROFILE_SCOPE("hnd_poll_event_batch");
+
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return 0;
+  if (!hnd_assert(_events != NULL || _capacity == 0, HND_SYNTAX))
+    return 0;
+
+  hnd_drain_xcb_events(_window);
+
+  return hnd_pop_window_events(_window, _events, _capacity);
+}
+
+/**
+ * @brief Waits until the ring has room for hnd_filter_event, or the input thread stops.
+ *
+ * @note Waits for the main loop instead of dropping, a lost release would leave a key stuck.
+ */
+static void
+hnd_wait_for_event_space
+(
+  hnd_linux_window_t *_window
+)
+{
+  while (hnd_get_event_count(&_window->events) > HND_EVENT_RING_CAPACITY - HND_EVENT_FILTER_SLOTS &&
+         __atomic_load_n(&_window->input_thread_running, __ATOMIC_ACQUIRE))
+    nanosleep(&(struct timespec){ 0, HND_NANOSECONDS_PER_MILLISECOND }, NULL);
+}
+
+/**
+ * @brief Input thread loop, see hnd_start_input_thread.
+ */
+static void
+hnd_run_input_thread
+(
+  void *_window
+)
+{
+  hnd_linux_window_t *window = (hnd_linux_window_t *)_window;
+
+  while (__atomic_load_n(&window->input_thread_running, __ATOMIC_ACQUIRE))
+  {
+    /* @note NULL means the connection broke */
+    xcb_generic_event_t *xcb_event = xcb_wait_for_event(window->connection);
+    if (!xcb_event)
+      break;
+
+    /* @note Takes the whole burst behind it too, so it gets coalesced */
+    while (xcb_event)
+    {
+      hnd_input_event_t event;
+      if (hnd_translate_xcb_event(window, xcb_event, &event))
+      {
+        hnd_wait_for_event_space(window);
+        hnd_filter_event(&window->event_filter, &window->events, &event);
+      }
+
+      /* @note Focus loss releases, each one waits for room like any other event */
+      do
+        hnd_wait_for_event_space(window);
+      while (hnd_release_held_input(&window->event_filter, &window->events));
+
+      free(xcb_event);
+      xcb_event = xcb_poll_for_event(window->connection);
+    }
+
+    hnd_flush_event_filter(&window->event_filter, &window->events);
+
+    /* @note Wakes hnd_wait_events up */
+    uint64_t one = 1;
+    ssize_t size = write(window->wake_fd, &one, sizeof(one));
+    (void)size;
+  }
+}
+
+int
+hnd_add_wait_source
+(
+  hnd_linux_window_t *_window,
+  int                 _fd
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  struct epoll_event event = { .events = EPOLLIN, .data.fd = _fd };
+
+  return hnd_assert(epoll_ctl(_window->epoll_fd, EPOLL_CTL_ADD, _fd, &event) == 0,
+                    "Could not add a wait source");
+}
+
+void
+hnd_remove_wait_source
+(
+  hnd_linux_window_t *_window,
+  int                 _fd
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return;
+
+  epoll_ctl(_window->epoll_fd, EPOLL_CTL_DEL, _fd, NULL);
+}
+
+int
+hnd_wait_events
+(
+  hnd_linux_window_t *_window,
+  int64_t             _timeout
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  /* @note Whatever xcb already read from the socket won't wake epoll up */
+  hnd_drain_xcb_events(_window);
+  if (hnd_get_event_count(&_window->events))
+    return HND_OK;
+
+  if (!_window->headless)
+    xcb_flush(_window->connection);
+
+  int64_t timeout = _timeout;
+  if (timeout >= 0 && !__atomic_load_n(&_window->visible, __ATOMIC_RELAXED))
+    timeout = timeout > HND_WAIT_HIDDEN_INTERVAL ? timeout : HND_WAIT_HIDDEN_INTERVAL;
+  else if (timeout >= 0 && !__atomic_load_n(&_window->focused, __ATOMIC_RELAXED))
+    timeout = timeout > HND_WAIT_UNFOCUSED_INTERVAL ? timeout : HND_WAIT_UNFOCUSED_INTERVAL;
+
+  /* @note epoll_wait only counts milliseconds, the timer keeps the deadline exact. A zero
+   * value disarms it.
+   */
+  struct itimerspec deadline;
+  memset(&deadline, 0x00, sizeof(deadline));
+  if (timeout > 0)
+  {
+    deadline.it_value.tv_sec = (time_t)(timeout / (int64_t)HND_NANOSECONDS_PER_SECOND);
+    deadline.it_value.tv_nsec = (long)(timeout % (int64_t)HND_NANOSECONDS_PER_SECOND);
+  }
+  timerfd_settime(_window->timer_fd, 0, &deadline, NULL);
+
+  struct epoll_event ready[HND_MAX_WAIT_SOURCES];
+  int count = epoll_wait(_window->epoll_fd, ready, HND_MAX_WAIT_SOURCES, timeout == 0 ? 0 : -1);
+
+  int woken = HND_NK;
+  for (int i = 0; i < count; ++i)
+  {
+    uint64_t value;
+    if (ready[i].data.fd == _window->timer_fd || ready[i].data.fd == _window->wake_fd)
+    {
+      /* @note Both are counters, reading resets them */
+      ssize_t size = read(ready[i].data.fd, &value, sizeof(value));
+      (void)size;
+    }
+
+    if (ready[i].data.fd != _window->timer_fd)
+      woken = HND_OK;
+  }
+
+  return woken;
+}
+
+int
+hnd_start_input_thread
+(
+  hnd_linux_window_t *_window
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (_window->input_thread_running)
+    return HND_OK;
+  if (_window->headless)
+  {
+    hnd_print_debug(HND_WARNING, "Headless windows have no input to read", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  /* @note The thread reads xcb from now on, hnd_wait_events waits for its wake ups */
+  hnd_remove_wait_source(_window, xcb_get_file_descriptor(_window->connection));
+
+  __atomic_store_n(&_window->input_thread_running, HND_OK, __ATOMIC_RELEASE);
+  if (!hnd_create_thread(&_window->input_thread, hnd_run_input_thread, _window))
+  {
+    __atomic_store_n(&_window->input_thread_running, HND_NK, __ATOMIC_RELEASE);
+    hnd_add_wait_source(_window, xcb_get_file_descriptor(_window->connection));
+    hnd_print_debug(HND_WARNING, "Could not start the input thread", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  return HND_OK;
+}
+
+void
+hnd_stop_input_thread
+(
+  hnd_linux_window_t *_window
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return;
+  if (!_window->input_thread_running)
+    return;
+
+  __atomic_store_n(&_window->input_thread_running, HND_NK, __ATOMIC_RELEASE);
+
+  /* @note Wakes the thread up from xcb_wait_for_event. A client message that isn't
+   * WM_DELETE_WINDOW translates to nothing.
+   */
+  union
+  {
+    xcb_client_message_event_t event;
+    char data[32];
+  } wake_event;
+  memset(&wake_event, 0x00, sizeof(wake_event));
+
+  wake_event.event.response_type = XCB_CLIENT_MESSAGE;
+  wake_event.event.format = 32;
+  wake_event.event.window = _window->handle;
+  wake_event.event.type = _window->wm_protocols->atom;
+  wake_event.event.data.data32[0] = XCB_NONE;
+
+  xcb_send_event(_window->connection,
+                 HND_NK,
+                 _window->handle,
+                 XCB_EVENT_MASK_NO_EVENT,
+                 wake_event.data);
+  xcb_flush(_window->connection);
+
+  hnd_join_thread(&_window->input_thread);
+  hnd_add_wait_source(_window, xcb_get_file_descriptor(_window->connection));
+}
+
+int
+hnd_set_window_event_filter
+(
+  hnd_linux_window_t *_window,
+  uint32_t            _mask,
+  uint32_t            _coalesce
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  __atomic_store_n(&_window->event_filter.mask, _mask, __ATOMIC_RELAXED);
+  __atomic_store_n(&_window->event_filter.coalesce, _coalesce, __ATOMIC_RELAXED);
+  if (_window->headless)
+    return HND_OK;
+
+  /* @note Masked out input isn't even sent by the server anymore */
+  _window->event_mask &= ~(uint32_t)(XCB_EVENT_MASK_KEY_PRESS      |
+                                     XCB_EVENT_MASK_KEY_RELEASE    |
+                                     XCB_EVENT_MASK_BUTTON_PRESS   |
+                                     XCB_EVENT_MASK_BUTTON_RELEASE |
+                                     XCB_EVENT_MASK_POINTER_MOTION |
+                                     XCB_EVENT_MASK_BUTTON_MOTION);
+  if (_mask & HND_EVENT_MASK_KEY)
+    _window->event_mask |= XCB_EVENT_MASK_KEY_PRESS | XCB_EVENT_MASK_KEY_RELEASE;
+  if (_mask & HND_EVENT_MASK_MOUSE_BUTTON)
+    _window->event_mask |= XCB_EVENT_MASK_BUTTON_PRESS | XCB_EVENT_MASK_BUTTON_RELEASE;
+  if (_mask & HND_EVENT_MASK_MOUSE_MOVE)
+    _window->event_mask |= XCB_EVENT_MASK_POINTER_MOTION | XCB_EVENT_MASK_BUTTON_MOTION;
+
+  xcb_change_window_attributes(_window->connection, _window->handle, XCB_CW_EVENT_MASK, &_window->event_mask);
+  xcb_flush(_window->connection);
+
+  return HND_OK;
+}
+
+/**
+ * @brief Creates a fully transparent cursor, to hide the pointer while it's locked.
+ */
+static xcb_cursor_t
+hnd_create_hidden_cursor
+(
+  hnd_linux_window_t *_window
+)
+{
+  /* @note New pixmaps hold garbage, clear it so no pixel shows */
+  xcb_pixmap_t pixmap = xcb_generate_id(_window->connection);
+  xcb_create_pixmap(_window->connection, 1, pixmap, _window->handle, 1, 1);
+
+  uint32_t foreground = 0;
+  xcb_gcontext_t context = xcb_generate_id(_window->connection);
+  xcb_create_gc(_window->connection, context, pixmap, XCB_GC_FOREGROUND, &foreground);
+  xcb_poly_fill_rectangle(_window->connection, pixmap, context, 1, &(xcb_rectangle_t){ 0, 0, 1, 1 });
+  xcb_free_gc(_window->connection, context);
+
+  xcb_cursor_t cursor = xcb_generate_id(_window->connection);
+  xcb_create_cursor(_window->connection, cursor, pixmap, pixmap, 0, 0, 0, 0, 0, 0, 0, 0);
+  xcb_free_pixmap(_window->connection, pixmap);
+
+  return cursor;
+}
+
+int
+hnd_set_window_relative_mouse
+(
+  hnd_linux_window_t *_window,
+  int                 _relative
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (_window->headless)
+    return _relative ? HND_NK : HND_OK;
+
+  if (!_relative)
+  {
+    if (_window->relative_mouse)
+    {
+      xcb_ungrab_pointer(_window->connection, XCB_CURRENT_TIME);
+      xcb_flush(_window->connection);
+    }
+    _window->relative_mouse = HND_NK;
+
+    return HND_OK;
+  }
+
+  if (_window->hidden_cursor == XCB_NONE)
+    _window->hidden_cursor = hnd_create_hidden_cursor(_window);
+
+  /* @note Events keep going to the window as usual, the grab only confines and hides the pointer */
+  xcb_grab_pointer_reply_t *grab =
+    xcb_grab_pointer_reply(_window->connection,
+                           xcb_grab_pointer(_window->connection,
+                                            1,
+                                            _window->handle,
+                                            XCB_EVENT_MASK_BUTTON_PRESS   |
+                                            XCB_EVENT_MASK_BUTTON_RELEASE |
+                                            XCB_EVENT_MASK_POINTER_MOTION,
+                                            XCB_GRAB_MODE_ASYNC,
+                                            XCB_GRAB_MODE_ASYNC,
+                                            _window->handle,
+                                            _window->hidden_cursor,
+                                            XCB_CURRENT_TIME),
+                           NULL);
+  int grabbed = grab && grab->status == XCB_GRAB_STATUS_SUCCESS;
+  free(grab);
+  if (!grabbed)
+  {
+    hnd_print_debug(HND_WARNING, "Could not lock the pointer", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  /* @note Centered, so core motion has room on every side */
+  xcb_warp_pointer(_window->connection,
+                   XCB_NONE,
+                   _window->handle,
+                   0,
+                   0,
+                   0,
+                   0,
+                   (int16_t)(_window->size[0] / 2),
+                   (int16_t)(_window->size[1] / 2));
+  xcb_flush(_window->connection);
+
+  _window->relative_mouse = HND_OK;
+
+  return HND_OK;
 }
 
 int
@@ -338,11 +1103,23 @@ hnd_set_window_position
 {
   if (!hnd_assert(_window != NULL, HND_SYNTAX))
     return HND_NK;
+  if (_window->headless)
+  {
+    hnd_copy_vec2(_position, _window->position);
 
-  /* @note From the man page for xcb_send_event, 32 bytes should be allocated. */
-  xcb_configure_notify_event_t *temp_notify_event = calloc(32, 1);
-  if (!hnd_assert(temp_notify_event != NULL, NULL))
-    return HND_NK;
+    return HND_OK;
+  }
+
+  /* @note From the man page for xcb_send_event, 32 bytes should be sent. They live on the
+   * stack, since xcb_send_event copies them into its output buffer.
+   */
+  union
+  {
+    xcb_configure_notify_event_t event;
+    char data[32];
+  } notify_event;
+  memset(&notify_event, 0x00, sizeof(notify_event));
+  xcb_configure_notify_event_t *temp_notify_event = &notify_event.event;
 
   temp_notify_event->event = _window->handle;
   temp_notify_event->window = _window->handle;
@@ -359,7 +1136,6 @@ hnd_set_window_position
                  (char *)temp_notify_event);
 
   xcb_flush(_window->connection);
-  free(temp_notify_event);
 
   return HND_OK;
 }
@@ -392,6 +1168,9 @@ hnd_set_window_title
     return;
 
   _window->title = _title;
+  if (_window->headless)
+    return;
+
   xcb_change_property(_window->connection,
                       XCB_PROP_MODE_REPLACE,
                       _window->handle,
@@ -27,6 +27,9 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+#include "../../core/event/event.h"
+#include "../../core/event/record.h"
+#include "../../core/thread/thread.h"
 #include "../video.h"
 #include "../renderer/renderer.h"
 
@@ -36,11 +39,13 @@ extern "C"
 typedef struct hnd_linux_window_t
 {
   char *title;
-  hnd_vector_t position;
-  hnd_vector_t size;
+  hnd_vec2_t position;
+  hnd_vec2_t size;
   unsigned int decoration;
   unsigned int fullscreen;
   int running;
+  /* @note See hnd_create_headless_window, nothing below touches X then */
+  int headless;
 
   xcb_connection_t *connection;
   xcb_screen_t *screen_data;
@@ -55,8 +60,62 @@ typedef struct hnd_linux_window_t
   xcb_intern_atom_reply_t *wm_delete_window;
 
   hnd_renderer_t renderer;
+  hnd_event_ring_t events;
+  hnd_event_filter_t event_filter;
+  hnd_input_state_t input;
+  /* @note Set while the last hnd_poll_event_batch filled its buffer, the next call adds to the same frame */
+  int input_frame_open;
+
+  /* @note See hnd_set_window_recorder and hnd_set_window_replay */
+  hnd_recorder_t *recorder;
+  hnd_replay_t *replay;
+
+  /* @note See hnd_start_input_thread */
+  hnd_thread_t input_thread;
+  int input_thread_running;
+
+  /* @note See hnd_wait_events */
+  int epoll_fd;
+  int timer_fd;
+  int wake_fd;
+  int focused;
+  int visible;
+
+  /* @note See hnd_set_window_relative_mouse. xinput_opcode is 0 without XInput2. */
+  uint8_t xinput_opcode;
+  xcb_cursor_t hidden_cursor;
+  int relative_mouse;
+
+  /* @note Handle in the window pool, see hnd_get_window */
+  hnd_handle_t id;
 } hnd_linux_window_t;
 
+/* @note File descriptors hnd_wait_events can watch, its own three included */
+#define HND_MAX_WAIT_SOURCES 16
+
+/**
+ * @brief Makes hnd_wait_events also return when a file descriptor becomes readable,
+ * e.g. a joystick.
+ *
+ * @param _window Specifies the window.
+ * @param _fd     Specifies the file descriptor.
+ *
+ * @return The function state. HND_OK or HND_NK.
+ */
+int
+hnd_add_wait_source
+(
+  hnd_linux_window_t *_window,
+  int                 _fd
+);
+
+void
+hnd_remove_wait_source
+(
+  hnd_linux_window_t *_window,
+  int                 _fd
+);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -17,24 +17,54 @@
  */
 
 #include "window.h"
+#include "../../core/clock/clock.h"
+
+/**
+ * @brief Undoes a window creation that failed halfway and gives the slot back to the pool.
+ *
+ * @return NULL, for hnd_create_window to return.
+ */
+static hnd_win32_window_t *
+hnd_abort_window_creation
+(
+  hnd_win32_window_t *_window
+)
+{
+  if (_window->renderer.device_context)
+    ReleaseDC(_window->handle, _window->renderer.device_context);
+  if (_window->handle)
+  {
+    RemoveProp(_window->handle, HND_WINDOW_DATA_PROPERTY);
+    DestroyWindow(_window->handle);
+  }
+  UnregisterClass(HND_WINDOW_CLASS_NAME, GetModuleHandle(NULL));
+
+  hnd_free_window(_window);
+
+  return NULL;
+}
 
 hnd_win32_window_t *
 hnd_create_window
 (
   const char   *_title,
-  hnd_vector    _position,
-  hnd_vector    _size,
+  hnd_vector_t  _position,
+  hnd_vector_t  _size,
   unsigned int  _decoration
 )
 {
-  hnd_win32_window_t *new_window = malloc(sizeof(hnd_win32_window_t));
-  if (!hnd_assert(new_window != NULL, NULL))
+  HND_PROFILE_SCOPE("hnd_create_window");
+
+  hnd_win32_window_t *new_window = hnd_allocate_window();
+  if (!new_window)
     return NULL;
 
   new_window->title = (char *)_title;
-  hnd_copy_vector(_position, new_window->position);
-  hnd_copy_vector(_size, new_window->size);
+  hnd_copy_vec2(_position, new_window->position);
+  hnd_copy_vec2(_size, new_window->size);
   new_window->running = HND_OK;
+  new_window->focused = HND_OK;
+  new_window->visible = HND_OK;
   
  /* @note Make sure not assigned values are assigned zero */
   memset((void *)&new_window->class, 0x00, sizeof(WNDCLASS));
@@ -43,7 +73,7 @@ hnd_create_window
   new_window->class.hInstance = GetModuleHandle(NULL);
   new_window->class.lpszClassName = HND_WINDOW_CLASS_NAME;
   if (!hnd_assert(RegisterClass(&new_window->class), "Could not register window class"))
-    return NULL;
+    return hnd_abort_window_creation(new_window);
 
   new_window->rect =
     (RECT)
@@ -74,7 +104,7 @@ hnd_create_window
                                       new_window->class.hInstance,
                                       NULL);
   if (!hnd_assert(new_window->handle != NULL, "Could not create window"))
-    return NULL;
+    return hnd_abort_window_creation(new_window);
 
   /* @note Sets the window struct as a property assigned to it's window->handle so we can retrieve it
    * later on functions like hnd_window_proc.
@@ -86,20 +116,65 @@ hnd_create_window
    */
   if (!hnd_assert(SetProp(new_window->handle, HND_WINDOW_DATA_PROPERTY, new_window),
                   "Could not set window data as property"))
-    return NULL;
+    return hnd_abort_window_creation(new_window);
 
   /* @note Ends renderer binding: Device context */
   new_window->renderer.device_context = GetDC(new_window->handle);
   if (!hnd_assert(new_window->renderer.device_context != NULL, "Could not get window's device context"))
-    return NULL;
+    return hnd_abort_window_creation(new_window);
 
   if (!hnd_init_renderer(&new_window->renderer))
-    return NULL;
+    return hnd_abort_window_creation(new_window);
+
+  /* @note Raw mouse input comes as WM_INPUT, unaccelerated, while the window has focus */
+  RAWINPUTDEVICE mouse_device = { 0x01, 0x02, 0, new_window->handle };
+  if (RegisterRawInputDevices(&mouse_device, 1, sizeof(RAWINPUTDEVICE)))
+    new_window->input.raw_motion = HND_OK;
+  else
+    hnd_print_debug(HND_WARNING, "Could not register raw mouse input", HND_FAILURE);
   
   hnd_print_debug(HND_LOG, HND_CREATED("window"), HND_SUCCESS);
   return new_window;
 }
 
+hnd_win32_window_t *
+hnd_create_headless_window
+(
+  const char   *_title,
+  hnd_vector_t  _size,
+  unsigned int  _backend
+)
+{
+  HND_PROFILE_SCOPE("hnd_create_headless_window");
+
+  if (!hnd_assert(_backend == HND_RENDERER_OFFSCREEN || _backend == HND_RENDERER_NULL, HND_SYNTAX))
+    return NULL;
+
+  hnd_win32_window_t *new_window = hnd_allocate_window();
+  if (!new_window)
+    return NULL;
+
+  new_window->title = (char *)_title;
+  hnd_copy_vec2(_size, new_window->size);
+  new_window->running = HND_OK;
+  new_window->headless = HND_OK;
+  new_window->focused = HND_OK;
+  new_window->visible = HND_OK;
+
+  new_window->renderer.backend = _backend;
+  if (!hnd_init_renderer(&new_window->renderer))
+  {
+    hnd_print_debug(HND_WARNING, "Falling back to the null renderer", HND_FAILURE);
+
+    hnd_end_arena(&new_window->renderer.frame_arena);
+    new_window->renderer.backend = HND_RENDERER_NULL;
+    hnd_init_renderer(&new_window->renderer);
+  }
+
+  hnd_print_debug(HND_LOG, HND_CREATED("headless window"), HND_SUCCESS);
+  return new_window;
+}
+
 void
 hnd_destroy_window
 (
@@ -108,14 +183,23 @@ hnd_destroy_window
 {
   if (!hnd_assert(_window != NULL, HND_SYNTAX))
     return;
+  if (!hnd_assert(hnd_get_window(_window->id) == _window, "Window was already destroyed"))
+    return;
+
+  hnd_set_window_relative_mouse(_window, HND_NK);
 
   hnd_end_renderer(&_window->renderer);
-  ReleaseDC(_window->handle, _window->renderer.device_context);
+  if (!_window->headless)
+  {
+    ReleaseDC(_window->handle, _window->renderer.device_context);
 
-  RemoveProp(_window->handle, HND_WINDOW_DATA_PROPERTY);
-  UnregisterClass(HND_WINDOW_CLASS_NAME, GetModuleHandle(NULL));
+    RemoveProp(_window->handle, HND_WINDOW_DATA_PROPERTY);
+    UnregisterClass(HND_WINDOW_CLASS_NAME, GetModuleHandle(NULL));
+  }
 
   hnd_print_debug(HND_LOG, HND_ENDED("window"), HND_SUCCESS);
+
+  hnd_free_window(_window);
 }
 
 int
@@ -143,6 +227,8 @@ hnd_poll_events
   hnd_event_t        *_event
 )
 {
+  HND_PROFILE_SCOPE("hnd_poll_events");
+
   if (!hnd_assert(_window != NULL, HND_SYNTAX))
     return;
   if (!hnd_assert(_event != NULL, HND_SYNTAX))
@@ -160,6 +246,252 @@ hnd_poll_events
   DispatchMessage(&_event->message);
 }
 
+/**
+ * @brief Translates a queued win32 message into a compact event.
+ *
+ * @note Sent messages, like WM_SIZE and WM_CLOSE, skip the queue and only reach
+ * hnd_window_proc. Closing shows up as the window not running anymore.
+ *
+ * @return HND_NK if the message has nothing to report.
+ */
+static int
+hnd_translate_win32_message
+(
+  const MSG         *_message,
+  hnd_input_event_t *_event
+)
+{
+  int16_t x = (int16_t)LOWORD(_message->lParam);
+  int16_t y = (int16_t)HIWORD(_message->lParam);
+
+  _event->time = hnd_get_clock_ns();
+  _event->server_time = (uint32_t)_message->time;
+
+  switch (_message->message)
+  {
+  case WM_KEYDOWN:
+    /* @note Bit 30 is set if the key was already down */
+    _event->type = (_message->lParam & (1 << 30)) ? HND_EVENT_KEY_REPEAT : HND_EVENT_KEY_PRESS;
+    _event->key.code = (uint32_t)_message->wParam;
+
+    return HND_OK;
+  case WM_KEYUP:
+    _event->type = HND_EVENT_KEY_RELEASE;
+    _event->key.code = (uint32_t)_message->wParam;
+
+    return HND_OK;
+  case WM_LBUTTONDOWN:
+  case WM_RBUTTONDOWN:
+  case WM_MBUTTONDOWN:
+  case WM_MOUSEWHEEL:
+    _event->type = HND_EVENT_MOUSE_BUTTON_PRESS;
+    break;
+  case WM_LBUTTONUP:
+  case WM_RBUTTONUP:
+  case WM_MBUTTONUP:
+    _event->type = HND_EVENT_MOUSE_BUTTON_RELEASE;
+    break;
+  case WM_MOUSEMOVE:
+    _event->type = HND_EVENT_MOUSE_MOVE;
+    _event->motion.x = x;
+    _event->motion.y = y;
+    _event->motion.dx = 0;
+    _event->motion.dy = 0;
+
+    return HND_OK;
+  case WM_INPUT:
+  {
+    RAWINPUT raw;
+    UINT size = sizeof(RAWINPUT);
+    if (GetRawInputData((HRAWINPUT)_message->lParam, RID_INPUT, &raw, &size, sizeof(RAWINPUTHEADER)) == (UINT)-1 ||
+        raw.header.dwType != RIM_TYPEMOUSE ||
+        (raw.data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE))
+      return HND_NK;
+
+    /* @note Button changes come as regular messages too, only movement is taken */
+    _event->type = HND_EVENT_MOUSE_RAW_MOTION;
+    _event->raw_motion.dx = (float)raw.data.mouse.lLastX;
+    _event->raw_motion.dy = (float)raw.data.mouse.lLastY;
+
+    return raw.data.mouse.lLastX != 0 || raw.data.mouse.lLastY != 0;
+  }
+  default:
+    return HND_NK;
+  }
+
+  switch (_message->message)
+  {
+  case WM_LBUTTONDOWN:
+  case WM_LBUTTONUP:
+    _event->button.code = HND_MOUSE_BUTTON_LEFT;
+    break;
+  case WM_RBUTTONDOWN:
+  case WM_RBUTTONUP:
+    _event->button.code = HND_MOUSE_BUTTON_RIGHT;
+    break;
+  case WM_MBUTTONDOWN:
+  case WM_MBUTTONUP:
+    _event->button.code = HND_MOUSE_BUTTON_MIDDLE;
+    break;
+  default:
+    _event->button.code = ((short)HIWORD(_message->wParam) < 0)
+      ? HND_MOUSE_BUTTON_MIDDLE_DOWN
+      : HND_MOUSE_BUTTON_MIDDLE_UP;
+    break;
+  }
+  _event->button.x = x;
+  _event->button.y = y;
+
+  return HND_OK;
+}
+
+size_t
+hnd_poll_event_batch
+(
+  hnd_win32_window_t *_window,
+  hnd_input_event_t  *_events,
+  size_t              _capacity
+)
+{
+  HND_PROFILE_SCOPE("hnd_poll_event_batch");
+
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return 0;
+  if (!hnd_assert(_events != NULL || _capacity == 0, HND_SYNTAX))
+    return 0;
+
+  /* @note Stops once the ring is full, the rest stays in the message queue */
+  MSG message;
+  while (hnd_get_event_count(&_window->events) <= HND_EVENT_RING_CAPACITY - HND_EVENT_FILTER_SLOTS)
+  {
+    /* @note Focus loss releases go before anything newer */
+    if (hnd_release_held_input(&_window->event_filter, &_window->events))
+      continue;
+    if (!PeekMessage(&message, NULL, 0, 0, PM_REMOVE))
+      break;
+
+    hnd_input_event_t event;
+    if (hnd_translate_win32_message(&message, &event))
+      hnd_filter_event(&_window->event_filter, &_window->events, &event);
+
+    TranslateMessage(&message);
+    DispatchMessage(&message);
+  }
+  hnd_flush_event_filter(&_window->event_filter, &_window->events);
+
+  return hnd_pop_window_events(_window, _events, _capacity);
+}
+
+int
+hnd_set_window_relative_mouse
+(
+  hnd_win32_window_t *_window,
+  int                 _relative
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+  if (_window->headless)
+    return _relative ? HND_NK : HND_OK;
+
+  if (!_relative)
+  {
+    if (_window->relative_mouse)
+    {
+      ClipCursor(NULL);
+      ShowCursor(TRUE);
+    }
+    _window->relative_mouse = HND_NK;
+
+    return HND_OK;
+  }
+
+  /* @note ClipCursor takes screen coordinates */
+  RECT client_rect;
+  GetClientRect(_window->handle, &client_rect);
+  MapWindowPoints(_window->handle, NULL, (POINT *)&client_rect, 2);
+  if (!ClipCursor(&client_rect))
+  {
+    hnd_print_debug(HND_WARNING, "Could not lock the pointer", HND_FAILURE);
+
+    return HND_NK;
+  }
+
+  /* @note ShowCursor keeps a counter, hide only once */
+  if (!_window->relative_mouse)
+    ShowCursor(FALSE);
+  _window->relative_mouse = HND_OK;
+
+  return HND_OK;
+}
+
+int
+hnd_set_window_event_filter
+(
+  hnd_win32_window_t *_window,
+  uint32_t            _mask,
+  uint32_t            _coalesce
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  _window->event_filter.mask = _mask;
+  _window->event_filter.coalesce = _coalesce;
+
+  return HND_OK;
+}
+
+int
+hnd_wait_events
+(
+  hnd_win32_window_t *_window,
+  int64_t             _timeout
+)
+{
+  if (!hnd_assert(_window != NULL, HND_SYNTAX))
+    return HND_NK;
+
+  if (hnd_get_event_count(&_window->events))
+    return HND_OK;
+
+  int64_t timeout = _timeout;
+  if (timeout >= 0 && !_window->visible)
+    timeout = timeout > HND_WAIT_HIDDEN_INTERVAL ? timeout : HND_WAIT_HIDDEN_INTERVAL;
+  else if (timeout >= 0 && !_window->focused)
+    timeout = timeout > HND_WAIT_UNFOCUSED_INTERVAL ? timeout : HND_WAIT_UNFOCUSED_INTERVAL;
+
+  /* @note Rounded up, waking early would just spin */
+  DWORD milliseconds = timeout < 0
+    ? INFINITE
+    : (DWORD)((timeout + (int64_t)HND_NANOSECONDS_PER_MILLISECOND - 1) / (int64_t)HND_NANOSECONDS_PER_MILLISECOND);
+
+  return MsgWaitForMultipleObjects(0, NULL, FALSE, milliseconds, QS_ALLINPUT) == WAIT_OBJECT_0;
+}
+
+int
+hnd_start_input_thread
+(
+  hnd_win32_window_t *_window
+)
+{
+  (void)_window;
+
+  /* @note Win32 delivers a window's messages to the thread that created it */
+  hnd_print_debug(HND_WARNING, "The input thread isn't supported on win32", HND_FAILURE);
+
+  return HND_NK;
+}
+
+void
+hnd_stop_input_thread
+(
+  hnd_win32_window_t *_window
+)
+{
+  (void)_window;
+}
+
 LRESULT CALLBACK
 hnd_window_proc
 (
@@ -172,9 +504,29 @@ hnd_window_proc
   switch (_message)
   {
   case WM_SIZE:
+  {
     hnd_resize_renderer_viewport(LOWORD(_lparam), HIWORD(_wparam));
 
-    break;
+    /* @note Sent before the property is set too */
+    hnd_win32_window_t *temp_window = (hnd_win32_window_t *)GetProp(_handle, HND_WINDOW_DATA_PROPERTY);
+    if (temp_window)
+      temp_window->visible = _wparam != SIZE_MINIMIZED;
+
+  } break;
+  case WM_SETFOCUS:
+  case WM_KILLFOCUS:
+  {
+    hnd_win32_window_t *temp_window = (hnd_win32_window_t *)GetProp(_handle, HND_WINDOW_DATA_PROPERTY);
+    if (temp_window)
+    {
+      temp_window->focused = _message == WM_SETFOCUS;
+
+      /* @note Keys let go while unfocused never get a WM_KEYUP, hnd_poll_event_batch releases them */
+      if (_message == WM_KILLFOCUS)
+        hnd_begin_input_release(&temp_window->event_filter, hnd_get_clock_ns());
+    }
+
+  } break;
   case WM_DESTROY:
   {
     hnd_win32_window_t *temp_window = (hnd_win32_window_t *)GetProp(_handle, HND_WINDOW_DATA_PROPERTY);
@@ -25,6 +25,7 @@ extern "C"
 #endif /* __cplusplus */
 
 #include "../../core/event/event.h"
+#include "../../core/event/record.h"
 #include "../video.h"
 #include "../renderer/renderer.h"
 
@@ -38,11 +39,13 @@ extern "C"
 typedef struct hnd_win32_window_t
 {
   char *title;
-  hnd_vector position;
-  hnd_vector size;
+  hnd_vec2_t position;
+  hnd_vec2_t size;
   unsigned int decoration;
   unsigned int fullscreen;
   int running;
+  /* @note See hnd_create_headless_window, there's no HWND then */
+  int headless;
 
   RECT rect;
   RECT *global_rect;
@@ -53,6 +56,25 @@ typedef struct hnd_win32_window_t
   DWORD extended_style;
 
   hnd_renderer_t renderer;
+  hnd_event_ring_t events;
+  hnd_event_filter_t event_filter;
+  hnd_input_state_t input;
+  /* @note Set while the last hnd_poll_event_batch filled its buffer, the next call adds to the same frame */
+  int input_frame_open;
+
+  /* @note See hnd_set_window_recorder and hnd_set_window_replay */
+  hnd_recorder_t *recorder;
+  hnd_replay_t *replay;
+
+  /* @note See hnd_wait_events */
+  int focused;
+  int visible;
+
+  /* @note See hnd_set_window_relative_mouse */
+  int relative_mouse;
+
+  /* @note Handle in the window pool, see hnd_get_window */
+  hnd_handle_t id;
 } hnd_win32_window_t;
 
 /**
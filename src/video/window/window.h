@@ -25,7 +25,10 @@ extern "C"
 #endif /* __cplusplus */
 
 #include "../../core/core.h"
+#include "../../core/clock/clock.h"
 #include "../../core/event/event.h"
+#include "../../core/memory/pool.h"
+#include "../../core/profile/profile.h"
 #include "../video.h"
 #include "../renderer/renderer.h"
 
@@ -42,6 +45,13 @@ typedef hnd_linux_window_t hnd_window_t;
 #define HND_WINDOW_DECORATION_MAXIMIZE 0x010
 #define HND_WINDOW_DECORATION_CLOSE    0x100
 #define HND_WINDOW_DECORATION_ALL      0x111
+
+/* @note Size of the window pool */
+#define HND_MAX_WINDOWS 8
+
+/* @note Shortest timeouts of hnd_wait_events while the window is hidden or unfocused */
+#define HND_WAIT_HIDDEN_INTERVAL    (250 * (int64_t)HND_NANOSECONDS_PER_MILLISECOND)
+#define HND_WAIT_UNFOCUSED_INTERVAL (33 * (int64_t)HND_NANOSECONDS_PER_MILLISECOND)
  
 /**
  * @brief Creates a window.
@@ -54,7 +64,8 @@ typedef hnd_linux_window_t hnd_window_t;
  * @param _size       Specifies the width and the height of the window.
  * @param _decoration Specifies the window's decoration flags.
  *
- * @return The created window.
+ * @return The created window. Keep its id, rather than the pointer, where the window may
+ *         be destroyed before it's used again.
  */
 hnd_window_t *
 hnd_create_window
@@ -65,9 +76,81 @@ hnd_create_window
   unsigned int  _decoration
 );
 
+/**
+ * @brief Creates a window without a display server, for tests, CI and batch simulation.
+ *
+ * @note Same hnd_window_t, it just never gets input and never shows up. Falls back to
+ * the null renderer if the offscreen one can't be created.
+ *
+ * @param _title   Specifies the window's title.
+ * @param _size    Specifies the size of the offscreen surface.
+ * @param _backend Specifies HND_RENDERER_OFFSCREEN or HND_RENDERER_NULL.
+ *
+ * @return The created window, or NULL.
+ */
+hnd_window_t *
+hnd_create_headless_window
+(
+  const char   *_title,
+  hnd_vector_t  _size,
+  unsigned int  _backend
+);
+
+/**
+ * @brief Gets a window from its id.
+ *
+ * @param _id Specifies the window's id.
+ *
+ * @return The window, or NULL if it was destroyed.
+ */
+hnd_window_t *
+hnd_get_window
+(
+  hnd_handle_t _id
+);
+
+/**
+ * @brief Takes a window struct from the window pool.
+ *
+ * @note Used by the platform implementations of hnd_create_window.
+ *
+ * @return The zero filled window, with its id set, or NULL.
+ */
+hnd_window_t *
+hnd_allocate_window
+(
+  void
+);
+
+/**
+ * @brief Hands out queued events, or the replay's, applies them to the window's input
+ * state and records them.
+ *
+ * @note Used by the platform implementations of hnd_poll_event_batch.
+ */
+size_t
+hnd_pop_window_events
+(
+  hnd_window_t      *_window,
+  hnd_input_event_t *_events,
+  size_t             _capacity
+);
+
+/**
+ * @brief Gives a window struct back to the window pool. Its id becomes invalid.
+ */
+void
+hnd_free_window
+(
+  hnd_window_t *_window
+);
+
 /**
  * @brief Ends a window.
  *
+ * @note Destroying a window twice is caught. Once another window is created its slot may
+ * be reused, so only the id is safe to keep around.
+ *
  * @param _window Specifies the window to be destroyed.
  */
 void
@@ -89,6 +172,147 @@ hnd_poll_events
   hnd_event_t  *_event
 );
 
+/**
+ * @brief Drains every pending event of the window.
+ *
+ * @note Events are queued in the window's ring first, so whatever doesn't fit in _events
+ * is returned by the next call. Nothing is allocated.
+ *
+ * @note Also updates the window's input state, call it once per frame so the pressed and
+ * released edges cover a frame. A call that fills _events keeps the frame open, so draining
+ * the rest with more calls adds to the same edges instead of clearing them.
+ *
+ * @param _window   Specifies the window.
+ * @param _events   Returns the events, oldest first.
+ * @param _capacity Specifies how many events fit in _events.
+ *
+ * @return How many events were written.
+ */
+size_t
+hnd_poll_event_batch
+(
+  hnd_window_t      *_window,
+  hnd_input_event_t *_events,
+  size_t             _capacity
+);
+
+/**
+ * @brief Sleeps until the window has events or the timeout expires.
+ *
+ * @note Meant to be called right before hnd_poll_event_batch, so an idle loop doesn't
+ * spin. While the window is hidden or unfocused, non negative timeouts are raised to
+ * HND_WAIT_HIDDEN_INTERVAL and HND_WAIT_UNFOCUSED_INTERVAL. Events still wake it at once.
+ *
+ * @param _window  Specifies the window.
+ * @param _timeout Specifies the timeout, in nanoseconds. 0 doesn't block, negative
+ *                 values block until something happens.
+ *
+ * @return HND_NK if the timeout expired first.
+ */
+int
+hnd_wait_events
+(
+  hnd_window_t *_window,
+  int64_t       _timeout
+);
+
+/**
+ * @brief Sets which events the window reports and which get coalesced.
+ *
+ * @note Coalescing merges a run of events of the same type into the latest one, so a
+ * burst of motion becomes one event, with the deltas summed. By default everything is
+ * reported and motion and window events are coalesced.
+ *
+ * @param _window   Specifies the window.
+ * @param _mask     Specifies the HND_EVENT_MASK_* categories to report.
+ * @param _coalesce Specifies the HND_EVENT_MASK_* categories to coalesce.
+ */
+int
+hnd_set_window_event_filter
+(
+  hnd_window_t *_window,
+  uint32_t      _mask,
+  uint32_t      _coalesce
+);
+
+/**
+ * @brief Starts a thread that blocks on the window's events and queues them as they
+ * arrive, so input is read and timestamped independently of the frame rate.
+ *
+ * @note hnd_poll_event_batch then only pops what the thread queued, and hnd_poll_events
+ * always reports HND_EVENT_NONE. Linux only.
+ *
+ * @param _window Specifies the window.
+ *
+ * @return HND_NK if the thread couldn't start, polling keeps working as before.
+ */
+int
+hnd_start_input_thread
+(
+  hnd_window_t *_window
+);
+
+/**
+ * @brief Stops the input thread, if running.
+ *
+ * @note Called by hnd_destroy_window.
+ */
+void
+hnd_stop_input_thread
+(
+  hnd_window_t *_window
+);
+
+/**
+ * @brief Records every event hnd_poll_event_batch hands out, a frame being every call up to
+ * one that doesn't fill its buffer.
+ *
+ * @param _window   Specifies the window.
+ * @param _recorder Specifies a started recorder, or NULL to stop recording. The window
+ *                  doesn't stop it.
+ */
+void
+hnd_set_window_recorder
+(
+  hnd_window_t   *_window,
+  hnd_recorder_t *_recorder
+);
+
+/**
+ * @brief Makes hnd_poll_event_batch hand out a recording instead of live input, one
+ * recorded frame per call.
+ *
+ * @note Live input is still read and thrown away, closing the window keeps working.
+ *
+ * @param _window Specifies the window.
+ * @param _replay Specifies an open replay, or NULL to go back to live input.
+ */
+void
+hnd_set_window_replay
+(
+  hnd_window_t *_window,
+  hnd_replay_t *_replay
+);
+
+/**
+ * @brief Locks the pointer to the window and hides it, for camera control. Read the
+ * movement from hnd_input_state_t's mouse_dx and mouse_dy.
+ *
+ * @note Raw motion is reported on Linux with HOUND_USE_XINPUT and on Windows, otherwise
+ * deltas come from regular motion and stop at the window's edges.
+ *
+ * @param _window   Specifies the window.
+ * @param _relative Specifies whether to lock (HND_OK) or release (HND_NK) the pointer.
+ *
+ * @return HND_NK if the pointer couldn't be locked.
+ */
+int
+hnd_set_window_relative_mouse
+(
+  hnd_window_t *_window,
+  int           _relative
+);
+
 /**
  * @brief Sets window position.
  *
@@ -0,0 +1,130 @@
+/**
+ * @file test/action.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+static void
+print_action
+(
+  const hnd_action_map_t *_map,
+  int                     _action
+)
+{
+  const hnd_action_state_t *state = hnd_get_action(_map, _action);
+  printf("%-8s value %5.2f down %d pressed %d released %d\n",
+         _map->names[_action],
+         state->value,
+         state->down,
+         state->pressed,
+         state->released);
+}
+
+static void
+run_frame
+(
+  hnd_action_map_t        *_map,
+  const hnd_input_event_t *_events,
+  size_t                   _count,
+  const int               *_actions,
+  size_t                   _action_count
+)
+{
+  hnd_update_actions(_map, _events, _count);
+  for (size_t i = 0; i < _action_count; ++i)
+    print_action(_map, _actions[i]);
+  printf("\n");
+}
+
+static hnd_input_event_t
+key_event
+(
+  uint32_t _type,
+  uint32_t _code
+)
+{
+  hnd_input_event_t event;
+  memset(&event, 0x00, sizeof(event));
+  event.type = _type;
+  event.key.code = _code;
+
+  return event;
+}
+
+int
+main
+(
+  void
+)
+{
+  hnd_action_map_t map;
+  hnd_init_action_map(&map);
+
+  int actions[3] =
+  {
+    hnd_add_action(&map, "move_x"),
+    hnd_add_action(&map, "jump"),
+    hnd_add_action(&map, "save"),
+  };
+
+  hnd_bind_action(&map, actions[0], HND_KEY_A, HND_ACTION_NO_MODIFIER, -1.0f);
+  hnd_bind_action(&map, actions[0], HND_KEY_D, HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_bind_action_axis(&map, actions[0], 0, HND_JOYSTICK_AXIS_LEFT_X, 1.0f);
+  hnd_bind_action(&map, actions[1], HND_KEY_SPACE, HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_bind_action(&map, actions[1], HND_ACTION_CODE_MOUSE_BUTTON(HND_MOUSE_BUTTON_LEFT), HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_bind_action(&map, actions[1], HND_ACTION_CODE_JOYSTICK_BUTTON(0, HND_JOYSTICK_BUTTON_SOUTH), HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_bind_action(&map, actions[2], HND_KEY_S, HND_KEY_LEFT_CONTROL, 1.0f);
+  hnd_compile_action_map(&map);
+
+  printf("-- KEYS --\n");
+  hnd_input_event_t events[4] =
+  {
+    key_event(HND_EVENT_KEY_PRESS, HND_KEY_D),
+    key_event(HND_EVENT_KEY_PRESS, HND_KEY_SPACE),
+    key_event(HND_EVENT_KEY_RELEASE, HND_KEY_SPACE),
+  };
+  run_frame(&map, events, 3, actions, 3);
+
+  events[0] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_A);
+  run_frame(&map, events, 1, actions, 3);
+
+  events[0] = key_event(HND_EVENT_KEY_RELEASE, HND_KEY_D);
+  run_frame(&map, events, 1, actions, 3);
+
+  printf("-- CHORDS --\n");
+  events[0] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_S);
+  events[1] = key_event(HND_EVENT_KEY_RELEASE, HND_KEY_S);
+  run_frame(&map, events, 2, actions, 3);
+
+  events[0] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_LEFT_CONTROL);
+  events[1] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_S);
+  run_frame(&map, events, 2, actions, 3);
+
+  events[0] = key_event(HND_EVENT_KEY_RELEASE, HND_KEY_LEFT_CONTROL);
+  run_frame(&map, events, 1, actions, 3);
+
+  printf("-- REBIND --\n");
+  hnd_clear_action_bindings(&map, actions[1]);
+  hnd_bind_action(&map, actions[1], HND_KEY_W, HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_compile_action_map(&map);
+
+  events[0] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_SPACE);
+  events[1] = key_event(HND_EVENT_KEY_PRESS, HND_KEY_W);
+  run_frame(&map, events, 2, actions, 2);
+
+  return 0;
+}
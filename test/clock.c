@@ -0,0 +1,94 @@
+/**
+ * @file test/clock.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+#define CLOCK_TEST_READS 1000000
+
+static void
+time_reads
+(
+  void
+)
+{
+  uint64_t start = hnd_get_clock_ns();
+  uint64_t sink = 0;
+  for (int i = 0; i < CLOCK_TEST_READS; ++i)
+    sink += hnd_get_clock_ns();
+  uint64_t ns_cost = hnd_get_clock_ns() - start;
+
+  start = hnd_get_clock_ns();
+  for (int i = 0; i < CLOCK_TEST_READS; ++i)
+    sink += hnd_get_clock_ticks();
+  uint64_t tick_cost = hnd_get_clock_ns() - start;
+
+  printf("hnd_get_clock_ns %.1f ns, hnd_get_clock_ticks %.1f ns a read (%llu)\n",
+         (double)ns_cost / CLOCK_TEST_READS,
+         (double)tick_cost / CLOCK_TEST_READS,
+         (unsigned long long)(sink & 1));
+}
+
+int
+main
+(
+  void
+)
+{
+  time_reads();
+
+  int tsc = hnd_calibrate_clock_ticks(0);
+  printf("Ticks from the %s\n", tsc ? "time stamp counter" : "monotonic clock");
+  time_reads();
+
+  /* @note Both clocks should agree over a sleep */
+  uint64_t start_ns = hnd_get_clock_ns();
+  uint64_t start_ticks = hnd_get_clock_ticks();
+  hnd_sleep_until_ns(start_ns + 50 * HND_NANOSECONDS_PER_MILLISECOND);
+  uint64_t ticks_ns = hnd_ticks_to_ns(hnd_get_clock_ticks() - start_ticks);
+  uint64_t clock_ns = hnd_get_clock_ns() - start_ns;
+  printf("Slept %.3f ms, ticks say %.3f ms\n", (double)clock_ns / 1e6, (double)ticks_ns / 1e6);
+
+  /* @note 1% of the frames hitch, the average barely moves but p99 does */
+  hnd_frame_timings_t timings;
+  hnd_init_frame_timings(&timings, HND_TIMING_DEFAULT_HITCH);
+  for (int i = 0; i < 1000; ++i)
+  {
+    uint64_t frame = i % 100 == 99 ? 50 * HND_NANOSECONDS_PER_MILLISECOND : 16666667 + (i % 7) * 100000;
+    hnd_add_timing_sample(&timings.channels[HND_FRAME_TIMING_FRAME], frame);
+    hnd_add_timing_sample(&timings.channels[HND_FRAME_TIMING_UPDATE], 2 * HND_NANOSECONDS_PER_MILLISECOND);
+    hnd_add_timing_sample(&timings.channels[HND_FRAME_TIMING_RENDER], 5 * HND_NANOSECONDS_PER_MILLISECOND);
+    hnd_add_timing_sample(&timings.channels[HND_FRAME_TIMING_SWAP], 9 * HND_NANOSECONDS_PER_MILLISECOND);
+  }
+  hnd_print_frame_timings(&timings);
+
+  /* @note Past two windows, the first thousand are forgotten */
+  for (int i = 0; i < 2 * HND_TIMING_WINDOW; ++i)
+    hnd_add_timing_sample(&timings.channels[HND_FRAME_TIMING_FRAME], 8 * HND_NANOSECONDS_PER_MILLISECOND);
+
+  hnd_timing_report_t report;
+  hnd_get_timing_report(&timings.channels[HND_FRAME_TIMING_FRAME], &report);
+  printf("After %d more: p50 %.3f p99 %.3f max %.3f ms, %llu hitches over %llu samples\n",
+         2 * HND_TIMING_WINDOW,
+         (double)report.p50_ns / 1e6,
+         (double)report.p99_ns / 1e6,
+         (double)report.max_ns / 1e6,
+         (unsigned long long)report.hitches,
+         (unsigned long long)report.count);
+
+  return 0;
+}
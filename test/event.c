@@ -18,6 +18,86 @@
 
 #include "../src/hound.h"
 
+static void
+on_key
+(
+  const hnd_input_event_t *_event,
+  void                    *_data
+)
+{
+  (void)_data;
+
+  if (_event->type == HND_EVENT_KEY_PRESS)
+    printf("Key pressed: %u, %.3f ms ago\n", _event->key.code, (double)(hnd_get_clock_ns() - _event->time) / 1e6);
+  else if (_event->type == HND_EVENT_KEY_REPEAT)
+    printf("Key repeated: %u\n", _event->key.code);
+  else
+    printf("Key released: %u\n", _event->key.code);
+}
+
+static void
+on_space
+(
+  const hnd_input_event_t *_event,
+  void                    *_data
+)
+{
+  (void)_data;
+
+  if (_event->type == HND_EVENT_KEY_PRESS)
+    printf("Space pressed\n");
+}
+
+static void
+on_button
+(
+  const hnd_input_event_t *_event,
+  void                    *_data
+)
+{
+  (void)_data;
+
+  if (_event->type == HND_EVENT_MOUSE_BUTTON_RELEASE)
+    printf("Button %u released at: %d - %d\n", _event->button.code, _event->button.x, _event->button.y);
+  else if (_event->button.code == HND_MOUSE_BUTTON_MIDDLE_UP)
+    printf("Mouse wheel scrolled up at: %d - %d\n", _event->button.x, _event->button.y);
+  else if (_event->button.code == HND_MOUSE_BUTTON_MIDDLE_DOWN)
+    printf("Mouse wheel scrolled down at: %d - %d\n", _event->button.x, _event->button.y);
+  else
+    printf("Button %u pressed at: %d - %d\n", _event->button.code, _event->button.x, _event->button.y);
+}
+
+static void
+on_motion
+(
+  const hnd_input_event_t *_event,
+  void                    *_data
+)
+{
+  (void)_data;
+
+  if (_event->type == HND_EVENT_MOUSE_RAW_MOTION)
+    printf("Mouse raw motion: %.3f : %.3f\n", _event->raw_motion.dx, _event->raw_motion.dy);
+  else
+    printf("Mouse moved at: %d : %d, by %d : %d\n", _event->motion.x, _event->motion.y, _event->motion.dx, _event->motion.dy);
+}
+
+static void
+on_configure
+(
+  const hnd_input_event_t *_event,
+  void                    *_data
+)
+{
+  (void)_data;
+
+  printf("Window configured: %d ; %d, %u x %u\n",
+         _event->configure.x,
+         _event->configure.y,
+         _event->configure.width,
+         _event->configure.height);
+}
+
 int
 main
 (
@@ -31,33 +111,44 @@ main
 
   hnd_set_renderer_clear_color(0.2f, 0.2f, 0.2f, 1.0f);
 
-  hnd_event_t event;
-#ifdef HND_WIN32
-  hnd_set_window_event(window, &event);
-#endif /* HND_WIN32 */
+  hnd_event_dispatcher_t dispatcher;
+  hnd_init_event_dispatcher(&dispatcher);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_KEY_PRESS, on_key, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_KEY_REPEAT, on_key, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_KEY_RELEASE, on_key, NULL);
+  hnd_subscribe_key(&dispatcher, HND_KEY_SPACE, on_space, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_MOUSE_BUTTON_PRESS, on_button, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_MOUSE_BUTTON_RELEASE, on_button, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_MOUSE_MOVE, on_motion, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_MOUSE_RAW_MOTION, on_motion, NULL);
+  hnd_subscribe_event(&dispatcher, HND_EVENT_WINDOW_CONFIGURE, on_configure, NULL);
+
+  /* @note Nothing else is even translated */
+  hnd_set_window_event_filter(window,
+                              hnd_get_dispatcher_mask(&dispatcher),
+                              HND_EVENT_MASK_MOUSE_MOVE | HND_EVENT_MASK_WINDOW);
+
+  hnd_input_event_t events[64];
+  hnd_start_input_thread(window);
 
   while (window->running)
   {
+    hnd_wait_events(window, HND_NANOSECONDS_PER_SECOND / 60);
     hnd_clear_render();
-    hnd_poll_events(window, &event);
-
-      if (event.type == HND_EVENT_KEY_PRESS)
-        printf("Key pressed: %d\n", event.keyboard.pressed_key);
-      else if (event.type == HND_EVENT_KEY_RELEASE)
-        printf("Key released: %d\n", event.keyboard.released_key);
-      else if (event.type == HND_EVENT_MOUSE_BUTTON_PRESS)
-      {
-        if (event.mouse.pressed_button == HND_MOUSE_BUTTON_MIDDLE_UP)
-          printf("Mouse wheel scrolled up at: %.2f - %.2f\n", event.mouse.pressed_position[0], event.mouse.pressed_position[1]);
-        else if (event.mouse.pressed_button == HND_MOUSE_BUTTON_MIDDLE_DOWN)
-          printf("Mouse wheel scrolled down at: %.2f - %.2f\n", event.mouse.pressed_position[0], event.mouse.pressed_position[1]);
-        else
-          printf("Button %d pressed at: %.2f - %.2f\n", event.mouse.pressed_button, event.mouse.pressed_position[0], event.mouse.pressed_position[1]);
-      }
-      else if (event.type == HND_EVENT_MOUSE_BUTTON_RELEASE)
-        printf("Button %d released at: %.2f - %.2f\n", event.mouse.released_button, event.mouse.released_position[0], event.mouse.released_position[1]);
-      else if (event.type == HND_EVENT_MOUSE_MOVE)
-        printf("Mouse moved at: %.2f : %.2f\n", event.mouse.position[0], event.mouse.position[1]);
+
+    size_t count = hnd_poll_event_batch(window, events, 64);
+    hnd_dispatch_events(&dispatcher, events, count);
+
+    if (hnd_key_down(&window->input, HND_KEY_SPACE) && hnd_button_down(&window->input, HND_MOUSE_BUTTON_LEFT))
+      printf("Space and left button held at: %d - %d\n", window->input.mouse_x, window->input.mouse_y);
+
+    /* @note Right click locks the pointer, escape releases it */
+    if (hnd_button_pressed_this_frame(&window->input, HND_MOUSE_BUTTON_RIGHT))
+      hnd_set_window_relative_mouse(window, HND_OK);
+    if (hnd_key_pressed_this_frame(&window->input, HND_KEY_ESC))
+      hnd_set_window_relative_mouse(window, HND_NK);
+    if (window->relative_mouse && (window->input.mouse_dx != 0.0f || window->input.mouse_dy != 0.0f))
+      printf("Camera turned by: %.3f : %.3f\n", window->input.mouse_dx, window->input.mouse_dy);
 
     hnd_swap_renderer_buffers(&window->renderer);
   }
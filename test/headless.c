@@ -0,0 +1,90 @@
+/**
+ * @file test/headless.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+#define HEADLESS_TEST_FRAMES 5
+
+static void
+run_frames
+(
+  hnd_window_t *_window
+)
+{
+  hnd_input_event_t events[16];
+
+  hnd_set_renderer_swap_interval(&_window->renderer, HND_VSYNC_OFF);
+  hnd_set_renderer_frame_limit(&_window->renderer, HND_NANOSECONDS_PER_SECOND / 60);
+
+  for (int frame = 0; frame < HEADLESS_TEST_FRAMES && _window->running; ++frame)
+  {
+    hnd_poll_event_batch(_window, events, 16);
+
+    hnd_set_renderer_clear_color(0.25f, 0.5f, 0.75f, 1.0f);
+    hnd_clear_render();
+
+    /* @note Nothing ever wakes a headless window up, the frame limiter paces it */
+    hnd_swap_renderer_buffers(&_window->renderer);
+  }
+
+  const hnd_frame_stats_t *stats = hnd_get_renderer_frame_stats(&_window->renderer);
+  printf("%llu frames, last %.2f ms, worked %.2f ms, average %.2f ms, missed %llu\n",
+         (unsigned long long)stats->frame_count,
+         (double)stats->frame_ns / 1e6,
+         (double)stats->work_ns / 1e6,
+         (double)stats->average_frame_ns / 1e6,
+         (unsigned long long)stats->missed_deadlines);
+}
+
+int
+main
+(
+  void
+)
+{
+  printf("-- OFFSCREEN --\n");
+  hnd_window_t *window = hnd_create_headless_window("Hound Engine Headless Test",
+                                                    (hnd_vector_t){ 64, 64 },
+                                                    HND_RENDERER_OFFSCREEN);
+  if (!window)
+    return 1;
+
+  run_frames(window);
+  if (window->renderer.backend == HND_RENDERER_OFFSCREEN)
+  {
+    unsigned char pixel[4];
+    glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    printf("Renderer: %s\n", (const char *)glGetString(GL_RENDERER));
+    printf("Cleared to: %u %u %u %u\n", pixel[0], pixel[1], pixel[2], pixel[3]);
+  }
+  else
+    printf("Fell back to the null renderer\n");
+  hnd_destroy_window(window);
+
+  printf("-- NULL --\n");
+  window = hnd_create_headless_window("Hound Engine Headless Test",
+                                      (hnd_vector_t){ 64, 64 },
+                                      HND_RENDERER_NULL);
+  if (!window)
+    return 1;
+
+  run_frames(window);
+  hnd_destroy_window(window);
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file test/joystick.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+#ifdef HND_LINUX
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/uinput.h>
+#endif /* HND_LINUX */
+
+#ifdef HND_LINUX
+/**
+ * @brief Sends an event through a uinput device.
+ */
+static void
+emit
+(
+  int            _fd,
+  unsigned short _type,
+  unsigned short _code,
+  int            _value
+)
+{
+  struct input_event event;
+  memset(&event, 0x00, sizeof(event));
+  event.type = _type;
+  event.code = _code;
+  event.value = _value;
+
+  ssize_t size = write(_fd, &event, sizeof(event));
+  (void)size;
+}
+
+/**
+ * @brief Polls until the first joystick is, or isn't, connected. Gives up after a second.
+ */
+static int
+wait_for_joystick
+(
+  int _connected
+)
+{
+  for (int i = 0; i < 100; ++i)
+  {
+    hnd_poll_joysticks();
+    if (hnd_get_joystick(0)->connected == _connected)
+      return HND_OK;
+
+    nanosleep(&(struct timespec){ 0, 10 * HND_NANOSECONDS_PER_MILLISECOND }, NULL);
+  }
+
+  return HND_NK;
+}
+#endif /* HND_LINUX */
+
+int
+main
+(
+  void
+)
+{
+  printf("-- NORMALIZE --\n");
+  int32_t raw[HND_JOYSTICK_MAX_AXES] = { -32768, -16384, 255, 0, 24576, 32767, -1, 1 };
+  float center[HND_JOYSTICK_MAX_AXES] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+  float scale[HND_JOYSTICK_MAX_AXES] = { 1 / 32767.5f, 1 / 32767.5f, 1 / 255.0f, 1 / 32767.5f, 1 / 32767.5f, 1 / 32767.5f, 1.0f, 1.0f };
+  float deadzone[HND_JOYSTICK_MAX_AXES] = { 0.1f, 0.1f, 0.0f, 0.1f, 0.5f, 0.1f, 0.1f, 0.1f };
+  float axes[HND_JOYSTICK_MAX_AXES];
+
+  hnd_select_joystick_kernels(0);
+  hnd_normalize_joystick_axes(raw, center, scale, deadzone, axes, HND_JOYSTICK_MAX_AXES);
+  for (int i = 0; i < HND_JOYSTICK_MAX_AXES; ++i)
+    printf("%.3f ", axes[i]);
+  printf("\n");
+
+  hnd_select_joystick_kernels(hnd_get_cpu_features());
+  hnd_normalize_joystick_axes(raw, center, scale, deadzone, axes, HND_JOYSTICK_MAX_AXES);
+  for (int i = 0; i < HND_JOYSTICK_MAX_AXES; ++i)
+    printf("%.3f ", axes[i]);
+  printf("\n");
+
+#ifdef HND_LINUX
+  printf("-- UINPUT --\n");
+  int fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+  if (fd < 0)
+  {
+    printf("uinput not available, skipped\n");
+
+    return 0;
+  }
+
+  /* @note A virtual gamepad with one button and one stick axis */
+  ioctl(fd, UI_SET_EVBIT, EV_KEY);
+  ioctl(fd, UI_SET_KEYBIT, BTN_SOUTH);
+  ioctl(fd, UI_SET_EVBIT, EV_ABS);
+  ioctl(fd, UI_SET_ABSBIT, ABS_X);
+
+  struct uinput_abs_setup abs_setup;
+  memset(&abs_setup, 0x00, sizeof(abs_setup));
+  abs_setup.code = ABS_X;
+  abs_setup.absinfo.minimum = -32768;
+  abs_setup.absinfo.maximum = 32767;
+  ioctl(fd, UI_ABS_SETUP, &abs_setup);
+
+  struct uinput_setup setup;
+  memset(&setup, 0x00, sizeof(setup));
+  setup.id.bustype = BUS_USB;
+  strcpy(setup.name, "Hound Test Gamepad");
+  ioctl(fd, UI_DEV_SETUP, &setup);
+  ioctl(fd, UI_DEV_CREATE);
+
+  hnd_init_joysticks();
+  printf("connected: %d\n", wait_for_joystick(HND_OK));
+
+  emit(fd, EV_KEY, BTN_SOUTH, 1);
+  emit(fd, EV_ABS, ABS_X, 16384);
+  emit(fd, EV_SYN, SYN_REPORT, 0);
+  nanosleep(&(struct timespec){ 0, 10 * HND_NANOSECONDS_PER_MILLISECOND }, NULL);
+  hnd_poll_joysticks();
+
+  const hnd_joystick_t *joystick = hnd_get_joystick(0);
+  printf("south down: %d, pressed: %d, x: %.2f\n",
+         hnd_joystick_button_down(joystick, HND_JOYSTICK_BUTTON_SOUTH),
+         hnd_joystick_button_pressed_this_frame(joystick, HND_JOYSTICK_BUTTON_SOUTH),
+         joystick->axes[HND_JOYSTICK_AXIS_LEFT_X]);
+
+  ioctl(fd, UI_DEV_DESTROY);
+  close(fd);
+  printf("disconnected: %d, released: %d\n",
+         wait_for_joystick(HND_NK),
+         hnd_joystick_button_released_this_frame(joystick, HND_JOYSTICK_BUTTON_SOUTH));
+
+  hnd_end_joysticks();
+#endif /* HND_LINUX */
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file test/matrix.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+int
+main
+(
+  void
+)
+{
+  printf("-- MULT --\n");
+  hnd_matrix_t translation;
+  hnd_translation_matrix(translation, (hnd_vector_t){ 10.0f, 20.0f, 0.0f });
+
+  hnd_matrix_t scale;
+  hnd_scale_matrix(scale, (hnd_vector_t){ 2.0f, 2.0f, 1.0f });
+
+  hnd_matrix_t model;
+  hnd_multiply_matrix(model, translation, scale);
+  hnd_print_matrix(model);
+
+  printf("-- INVERSE --\n");
+  hnd_matrix_t inverse;
+  hnd_invert_matrix(inverse, model);
+  hnd_print_matrix(inverse);
+
+  printf("-- TRANSFORM --\n");
+  hnd_vector_t points[3] = { { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 0.0f, 1.0f }, { 5.0f, 0.0f, 0.0f, 1.0f } };
+  hnd_transform_points(model, points, points, 3);
+  for (int i = 0; i < 3; ++i)
+    hnd_print_vector(points[i]);
+
+  printf("-- ORTHOGRAPHIC --\n");
+  hnd_matrix_t projection;
+  hnd_orthographic_matrix(projection, 0.0f, 800.0f, 600.0f, 0.0f, -1.0f, 1.0f);
+  hnd_transform_points(projection, points, points, 3);
+  for (int i = 0; i < 3; ++i)
+    hnd_print_vector(points[i]);
+
+  printf("-- AFFINE --\n");
+  hnd_affine_t sprite;
+  hnd_compose_affine(sprite, (hnd_vec2_t){ 100.0f, 50.0f }, 3.14159265f / 2.0f, (hnd_vec2_t){ 1.0f, 1.0f });
+
+  hnd_vec2_t corners[4] = { { 0.0f, 0.0f }, { 10.0f, 0.0f }, { 10.0f, 10.0f }, { 0.0f, 10.0f } };
+  hnd_transform_affine_points(sprite, corners, corners, 4);
+  for (int i = 0; i < 4; ++i)
+    printf("%.2f %.2f\n", corners[i][0], corners[i][1]);
+
+  printf("-- HIERARCHY --\n");
+  hnd_transform_tree_t *tree = hnd_create_transform_tree(4, NULL);
+  int32_t root = hnd_add_transform(tree, HND_TRANSFORM_ROOT);
+  int32_t arm = hnd_add_transform(tree, root);
+  int32_t hand = hnd_add_transform(tree, arm);
+  hnd_set_transform_position(tree, root, (hnd_vector_t){ 10.0f, 0.0f, 0.0f });
+  hnd_set_transform_rotation(tree, arm, (hnd_vector_t){ 0.0f, 0.0f, 0.70710678f, 0.70710678f });
+  hnd_set_transform_position(tree, hand, (hnd_vector_t){ 1.0f, 0.0f, 0.0f });
+  hnd_update_transform_tree(tree);
+  hnd_print_matrix(hnd_get_world_matrix(tree, hand));
+
+  hnd_set_transform_position(tree, arm, (hnd_vector_t){ 0.0f, 5.0f, 0.0f });
+  hnd_update_transform_tree(tree);
+  printf("changed: root %d arm %d hand %d\n", hnd_transform_changed(tree, root), hnd_transform_changed(tree, arm), hnd_transform_changed(tree, hand));
+  hnd_destroy_transform_tree(tree);
+
+  printf("-- CULL --\n");
+  float xs[5] = { 10.0f, -50.0f, 400.0f, 900.0f, 795.0f };
+  float ys[5] = { 10.0f, 10.0f, 300.0f, 300.0f, 598.0f };
+  float radii[5] = { 5.0f, 20.0f, 5.0f, 50.0f, 10.0f };
+  hnd_vector_soa_t centers = { xs, ys, NULL, NULL };
+  uint32_t visible[5];
+
+  size_t visible_count = hnd_cull_circle_rect(&centers, radii, 5, (hnd_vector_t){ 0.0f, 0.0f, 800.0f, 600.0f }, visible);
+  for (size_t i = 0; i < visible_count; ++i)
+    printf("%u ", visible[i]);
+  printf("\n");
+
+  hnd_frustum_t frustum;
+  hnd_extract_frustum(projection, &frustum);
+  visible_count = hnd_cull_sphere_frustum(&centers, radii, 5, &frustum, visible);
+  for (size_t i = 0; i < visible_count; ++i)
+    printf("%u ", visible[i]);
+  printf("\n");
+
+  return 0;
+}
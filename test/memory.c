@@ -0,0 +1,98 @@
+/**
+ * @file test/memory.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+int
+main
+(
+  void
+)
+{
+  printf("-- ARENA --\n");
+  hnd_arena_t arena;
+  hnd_init_arena(&arena, 4096, 0, HND_MEMORY_TAG_GENERAL);
+
+  float *values = hnd_push_arena(&arena, 100 * sizeof(float), 0);
+  for (int i = 0; i < 100; ++i)
+    values[i] = (float)i;
+  printf("%.2f aligned: %d\n", values[99], ((uintptr_t)values % HND_MEMORY_ALIGNMENT) == 0);
+
+  /* @note Bigger than a block, gets its own */
+  char *big = hnd_push_arena(&arena, 10000, 64);
+  memset(big, 'a', 10000);
+  printf("big aligned: %d\n", ((uintptr_t)big % 64) == 0);
+
+  hnd_reset_arena(&arena);
+  printf("reused: %d\n", hnd_push_arena(&arena, 16, 0) == (void *)values);
+
+  printf("-- ALLOCATOR --\n");
+  hnd_allocator_t allocator = hnd_get_arena_allocator(&arena);
+  int *numbers = hnd_allocate(&allocator, 4 * sizeof(int));
+  int *grown = hnd_reallocate(&allocator, numbers, 4 * sizeof(int), 8 * sizeof(int));
+  printf("grew in place: %d\n", grown == numbers);
+  hnd_end_arena(&arena);
+
+  int *heap_numbers = hnd_allocate(NULL, 4 * sizeof(int));
+  heap_numbers[3] = 7;
+  heap_numbers = hnd_reallocate(NULL, heap_numbers, 4 * sizeof(int), 64 * sizeof(int));
+  printf("%d\n", heap_numbers[3]);
+  hnd_deallocate(NULL, heap_numbers, 64 * sizeof(int));
+
+  printf("-- POOL --\n");
+  hnd_pool_t pool;
+  hnd_init_pool(&pool, sizeof(hnd_vector_t), 4, NULL);
+
+  hnd_handle_t first = hnd_acquire_pool_object(&pool);
+  hnd_handle_t second = hnd_acquire_pool_object(&pool);
+  hnd_copy_vector((hnd_vector_t){ 1.0f, 2.0f, 3.0f, 4.0f }, hnd_get_pool_object(&pool, second));
+  hnd_print_vector(hnd_get_pool_object(&pool, second));
+
+  hnd_release_pool_object(&pool, first);
+  hnd_handle_t reused = hnd_acquire_pool_object(&pool);
+  printf("same slot: %d, stale: %d, live: %d\n",
+         (reused & HND_HANDLE_INDEX_MASK) == (first & HND_HANDLE_INDEX_MASK),
+         hnd_get_pool_object(&pool, first) == NULL,
+         hnd_get_pool_object(&pool, reused) != NULL);
+  hnd_end_pool(&pool);
+
+  printf("-- STATS --\n");
+  hnd_allocator_t asset_allocator = hnd_get_tagged_allocator(HND_MEMORY_TAG_ASSET);
+  void *asset = hnd_allocate(&asset_allocator, 1000);
+  hnd_end_memory_frame();
+
+  hnd_memory_stats_t stats;
+  hnd_get_memory_stats(&stats);
+  printf("asset live: %zu, allocations: %zu, last frame: %zu\n",
+         stats.tags[HND_MEMORY_TAG_ASSET].live_bytes,
+         stats.tags[HND_MEMORY_TAG_ASSET].live_allocations,
+         stats.tags[HND_MEMORY_TAG_ASSET].last_frame_allocations);
+  printf("leaks: %zu\n", hnd_report_memory_leaks());
+
+  hnd_deallocate(&asset_allocator, asset, 1000);
+  hnd_print_memory_stats();
+  printf("leaks: %zu\n", hnd_report_memory_leaks());
+
+  printf("-- HUGE PAGES --\n");
+  size_t size = 1;
+  void *pages = hnd_map_memory(&size, HND_MEMORY_HUGE_PAGES);
+  printf("mapped %zu bytes\n", size);
+  hnd_unmap_memory(pages, size);
+
+  return 0;
+}
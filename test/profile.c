@@ -0,0 +1,108 @@
+/**
+ * @file test/profile.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+#define PROFILE_TEST_PATH "hound_profile_test.json"
+
+static volatile float sink;
+
+static void
+spin
+(
+  int _iterations
+)
+{
+  for (int i = 0; i < _iterations; ++i)
+    sink += (float)i * 0.5f;
+}
+
+static void
+work
+(
+  void *_data
+)
+{
+  HND_PROFILE_THREAD(_data);
+  HND_PROFILE_SCOPE("worker job");
+
+  for (int i = 0; i < 4; ++i)
+  {
+    HND_PROFILE_SCOPE("worker step");
+    spin(20000);
+  }
+}
+
+static void
+update
+(
+  hnd_run_t *_run,
+  float      _dt
+)
+{
+  HND_PROFILE_SCOPE("test update");
+  spin(5000);
+}
+
+static void
+render
+(
+  hnd_run_t *_run,
+  float      _alpha
+)
+{
+  hnd_clear_render();
+}
+
+int
+main
+(
+  void
+)
+{
+  hnd_init_profiler();
+  HND_PROFILE_THREAD("main");
+
+  hnd_thread_t threads[2];
+  hnd_create_thread(&threads[0], work, "worker 1");
+  hnd_create_thread(&threads[1], work, "worker 2");
+  hnd_join_thread(&threads[0]);
+  hnd_join_thread(&threads[1]);
+
+  hnd_window_t *window = hnd_create_headless_window("Hound Engine Profile Test",
+                                                    (hnd_vector_t){ 64, 64 },
+                                                    HND_RENDERER_OFFSCREEN);
+  if (!window)
+    return 1;
+
+  hnd_run_t run;
+  hnd_init_run(&run, HND_NANOSECONDS_PER_SECOND / 100);
+  run.update = update;
+  run.render = render;
+  run.step_limit = 30;
+  hnd_set_renderer_frame_limit(&window->renderer, HND_NANOSECONDS_PER_SECOND / 60);
+  hnd_run(window, &run);
+
+  hnd_destroy_window(window);
+
+  /* @note Open it in chrome://tracing or ui.perfetto.dev */
+  uint64_t zones = hnd_write_profile_trace(PROFILE_TEST_PATH);
+  printf("Wrote %llu zones to %s\n", (unsigned long long)zones, PROFILE_TEST_PATH);
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test/record.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+#define RECORD_TEST_PATH "hound_record_test.bin"
+
+int
+main
+(
+  void
+)
+{
+  printf("-- RECORD --\n");
+  hnd_recorder_t recorder;
+  if (!hnd_start_recording(&recorder, RECORD_TEST_PATH))
+    return 1;
+
+  /* @note Frame 1 has no events */
+  hnd_input_event_t events[3];
+  memset(events, 0x00, sizeof(events));
+  for (int frame = 0; frame < 4; ++frame)
+  {
+    size_t count = frame == 1 ? 0 : 3;
+    for (size_t i = 0; i < count; ++i)
+    {
+      events[i].type = HND_EVENT_MOUSE_MOVE;
+      events[i].time = hnd_get_clock_ns();
+      events[i].motion.x = (int16_t)(frame * 10 + i);
+      events[i].motion.y = (int16_t)frame;
+    }
+
+    hnd_record_events(&recorder, events, count);
+    hnd_end_recorder_frame(&recorder);
+  }
+  printf("Recorded %llu events over %llu frames\n",
+         (unsigned long long)recorder.count,
+         (unsigned long long)recorder.frame);
+  hnd_stop_recording(&recorder);
+
+  printf("-- REPLAY --\n");
+  hnd_replay_t replay;
+  if (!hnd_open_replay(&replay, RECORD_TEST_PATH))
+    return 1;
+
+  /* @note Small batches split frames over several calls */
+  while (!hnd_is_replay_done(&replay))
+  {
+    uint64_t frame = replay.frame;
+    size_t count = hnd_poll_replay_batch(&replay, events, 2);
+
+    printf("Frame %llu:", (unsigned long long)frame);
+    for (size_t i = 0; i < count; ++i)
+      printf(" %d : %d", events[i].motion.x, events[i].motion.y);
+    printf("\n");
+  }
+  hnd_close_replay(&replay);
+
+  printf("-- ZERO COPY --\n");
+  if (!hnd_open_replay(&replay, RECORD_TEST_PATH))
+    return 1;
+
+  while (!hnd_is_replay_done(&replay))
+  {
+    const hnd_input_record_t *records;
+    size_t count = hnd_next_replay_frame(&replay, &records);
+
+    printf("Frame %llu: %zu records\n", (unsigned long long)(replay.frame - 1), count);
+  }
+  hnd_close_replay(&replay);
+
+  remove(RECORD_TEST_PATH);
+
+  return 0;
+}
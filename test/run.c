@@ -0,0 +1,132 @@
+/**
+ * @file test/run.c
+ * @author Josue Teodoro Moreira <teodoro.josue@protonmail.ch>
+ * @date October 17, 2026
+ *
+ * Copyright (C) 2026 Josue Teodoro Moreira
+ *  
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+ * GNU General Public License for more details.
+ */
+
+#include "../src/hound.h"
+
+/* @note A ball falling at a constant speed, interpolated when drawn */
+typedef struct ball_t
+{
+  float previous;
+  float position;
+  float drawn;
+  int stall;
+} ball_t;
+
+static void
+update
+(
+  hnd_run_t *_run,
+  float      _dt
+)
+{
+  ball_t *ball = _run->data;
+
+  ball->previous = ball->position;
+  ball->position += 10.0f * _dt;
+}
+
+static void
+render
+(
+  hnd_run_t *_run,
+  float      _alpha
+)
+{
+  ball_t *ball = _run->data;
+
+  ball->drawn = ball->previous + (ball->position - ball->previous) * _alpha;
+
+  /* @note A hitch long enough to need more than max_steps to catch up */
+  if (ball->stall && _run->frame_count == 10)
+    hnd_sleep_until_ns(hnd_get_clock_ns() + 200 * HND_NANOSECONDS_PER_MILLISECOND);
+}
+
+static void
+print_run
+(
+  const char      *_name,
+  const hnd_run_t *_run,
+  const ball_t    *_ball,
+  uint64_t         _wall_ns
+)
+{
+  printf("%-12s %7llu steps, %7llu frames, simulated %8.2f ms in %8.2f ms, dropped %6.2f ms, ball at %.2f\n",
+         _name,
+         (unsigned long long)_run->step_count,
+         (unsigned long long)_run->frame_count,
+         (double)_run->time_ns / 1e6,
+         (double)_wall_ns / 1e6,
+         (double)_run->dropped_ns / 1e6,
+         _ball->drawn);
+}
+
+static void
+run_ball
+(
+  hnd_window_t *_window,
+  const char   *_name,
+  int           _unthrottled,
+  int           _stall,
+  uint64_t      _step_limit
+)
+{
+  ball_t ball = { 0.0f, 0.0f, 0.0f, _stall };
+
+  hnd_run_t run;
+  hnd_init_run(&run, HND_NANOSECONDS_PER_SECOND / 100);
+  run.update = update;
+  run.render = render;
+  run.data = &ball;
+  run.unthrottled = _unthrottled;
+  run.step_limit = _step_limit;
+
+  hnd_frame_timings_t timings;
+  hnd_init_frame_timings(&timings, HND_TIMING_DEFAULT_HITCH);
+  run.timings = &timings;
+
+  hnd_set_renderer_frame_limit(&_window->renderer, _unthrottled ? 0 : HND_NANOSECONDS_PER_SECOND / 60);
+
+  uint64_t start = hnd_get_clock_ns();
+  hnd_run(_window, &run);
+  print_run(_name, &run, &ball, hnd_get_clock_ns() - start);
+  hnd_print_frame_timings(&timings);
+}
+
+int
+main
+(
+  void
+)
+{
+  hnd_window_t *window = hnd_create_headless_window("Hound Engine Run Test",
+                                                    (hnd_vector_t){ 64, 64 },
+                                                    HND_RENDERER_NULL);
+  if (!window)
+    return 1;
+
+  hnd_calibrate_clock_ticks(0);
+
+  /* @note 100 steps a second, drawn at 60 frames a second */
+  run_ball(window, "throttled", HND_NK, HND_NK, 50);
+  run_ball(window, "stalled", HND_NK, HND_OK, 50);
+  run_ball(window, "unthrottled", HND_OK, HND_NK, 100000);
+
+  hnd_destroy_window(window);
+
+  return 0;
+}
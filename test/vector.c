@@ -77,4 +77,62 @@ main
   printf("-- DIV --\n");
   hnd_divide_vector(test_vector5, (hnd_vector_t){ 2.0f, 1.0f, 5.0f, 2.0f });
   hnd_print_vector(test_vector5);
+
+  printf("-- INLINE --\n");
+  hnd_vector_t test_vector6 = { 1.0f, 2.0f, 3.0f, 4.0f };
+  hnd_add_vector_inline(test_vector6, (hnd_vector_t){ 1.0f, 1.0f, 1.0f, 1.0f });
+  hnd_multiply_vector_inline(test_vector6, (hnd_vector_t){ 2.0f, 2.0f, 2.0f, 2.0f });
+  hnd_print_vector(test_vector6);
+
+  printf("-- SCALAR FALLBACK --\n");
+  hnd_vector_t test_vector7 = { 1.0f, 2.0f, 3.0f, 4.0f };
+  hnd_select_vector_kernels(0);
+  hnd_add_vector(test_vector7, (hnd_vector_t){ 1.0f, 1.0f, 1.0f, 1.0f });
+  hnd_multiply_vector(test_vector7, (hnd_vector_t){ 2.0f, 2.0f, 2.0f, 2.0f });
+  hnd_select_vector_kernels(hnd_get_cpu_features());
+  hnd_print_vector(test_vector7);
+
+  printf("-- ARRAY --\n");
+  hnd_vector_t positions[3] = { { 0.0f, 0.0f }, { 10.0f, 10.0f }, { 20.0f, 20.0f } };
+  hnd_vector_t velocities[3] = { { 1.0f, 2.0f }, { 1.0f, 2.0f }, { 1.0f, 2.0f } };
+  hnd_multiply_add_vector_array(positions, velocities, (hnd_vector_t){ 0.5f, 0.5f, 0.0f, 0.0f }, 3);
+  hnd_clamp_vector_array(positions, (hnd_vector_t){ 0.0f, 0.0f }, (hnd_vector_t){ 15.0f, 15.0f }, 3);
+  for (int i = 0; i < 3; ++i)
+    hnd_print_vector(positions[i]);
+
+  printf("-- SOA --\n");
+  float xs[3] = { 0.0f, 1.0f, 2.0f };
+  float ys[3] = { 4.0f, 5.0f, 6.0f };
+  hnd_vector_soa_t soa = { xs, ys, NULL, NULL };
+  hnd_scale_vector_soa(&soa, (hnd_vector_t){ 2.0f, 10.0f }, 3);
+  for (int i = 0; i < 3; ++i)
+    printf("%.2f %.2f\n", xs[i], ys[i]);
+
+  printf("-- COMPACT --\n");
+  hnd_vec2_t packed[3];
+  hnd_half_vec2_t half_packed[3];
+  hnd_pack_vec2_array(positions, packed, 3);
+  hnd_pack_half_vec2_array(positions, half_packed, 3);
+  hnd_unpack_half_vec2_array(half_packed, positions, 3);
+  for (int i = 0; i < 3; ++i)
+    printf("%.2f %.2f - %.2f %.2f\n", packed[i][0], packed[i][1], positions[i][0], positions[i][1]);
+
+  printf("-- LENGTH --\n");
+  hnd_vector_t direction = { 3.0f, 4.0f, 0.0f, 0.0f };
+  printf("%.4f %.4f\n", hnd_length_vector(direction), hnd_length_vector_approx(direction));
+  hnd_normalize_vector_approx(direction);
+  hnd_print_vector(direction);
+
+  printf("-- APPROX --\n");
+  float angles[3] = { 0.0f, 3.14159265f / 6.0f, 3.14159265f };
+  float sines[3], cosines[3];
+  hnd_sincos_array(angles, sines, cosines, 3);
+  for (int i = 0; i < 3; ++i)
+    printf("%.4f %.4f\n", sines[i], cosines[i]);
+
+  hnd_normalize_vector_array(velocities, 3);
+  for (int i = 0; i < 3; ++i)
+    hnd_print_vector(velocities[i]);
+
+  printf("CPU features: 0x%03x\n", hnd_get_cpu_features());
 }
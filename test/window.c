@@ -18,6 +18,46 @@
 
 #include "../src/hound.h"
 
+typedef struct window_test_t
+{
+  hnd_action_map_t actions;
+  int move;
+} window_test_t;
+
+/* @note Edges are per frame, while update runs any number of times per frame, so
+ * they are acted on here.
+ */
+static void
+input
+(
+  hnd_run_t               *_run,
+  const hnd_input_event_t *_events,
+  size_t                   _count
+)
+{
+  window_test_t *test = _run->data;
+
+  hnd_update_actions(&test->actions, _events, _count);
+
+  if (hnd_get_action(&test->actions, test->move)->pressed)
+    hnd_set_window_position(_run->window,
+                            (hnd_vector_t)
+                            {
+                              _run->window->position[0] - 5,
+                              _run->window->position[0] + 5
+                            });
+}
+
+static void
+render
+(
+  hnd_run_t *_run,
+  float      _alpha
+)
+{
+  hnd_clear_render();
+}
+
 int
 main
 (
@@ -30,34 +70,22 @@ main
                                            HND_WINDOW_DECORATION_ALL);
 
   hnd_set_renderer_clear_color(0.2f, 0.2f, 0.2f, 1.0f);
+  hnd_set_renderer_swap_interval(&window->renderer, HND_VSYNC_ADAPTIVE);
+  hnd_set_renderer_frame_limit(&window->renderer, HND_NANOSECONDS_PER_SECOND / 60);
 
-  hnd_event_t event;
-#ifdef HND_WIN32
-  hnd_set_window_event(window, &event);
-#endif /* HND_WIN32 */
-
-  while (window->running)
-  {
-    hnd_clear_render();
-    hnd_poll_events(window, &event);
-
-    switch (event.keyboard.pressed_key)
-    {
-    case HND_KEY_A:
-      hnd_set_window_position(window,
-                              (hnd_vector_t)
-                              {
-                                window->position[0] - 5,
-                                window->position[0] + 5
-                              });
+  /* @note Rebinding is a matter of binding again and recompiling */
+  window_test_t test;
+  hnd_init_action_map(&test.actions);
+  test.move = hnd_add_action(&test.actions, "move");
+  hnd_bind_action(&test.actions, test.move, HND_KEY_A, HND_ACTION_NO_MODIFIER, 1.0f);
+  hnd_compile_action_map(&test.actions);
 
-      break;
-    default:
-      break;
-    }
-  
-    hnd_swap_renderer_buffers(&window->renderer);
-  }
+  hnd_run_t run;
+  hnd_init_run(&run, HND_NANOSECONDS_PER_SECOND / 60);
+  run.input = input;
+  run.render = render;
+  run.data = &test;
+  hnd_run(window, &run);
 
   hnd_destroy_window(window);
 